@@ -270,11 +270,7 @@
     (vdom/vdom-mount! root app-state ui-component window)
 
     ;; ~60 FPS updates for smooth easing
-    (letfn [(schedule-update! []
-              (core/add-timer! update-interval (fn []
-                                                 (update-animations!)
-                                                 (schedule-update!))))]
-      (schedule-update!))
+    (core/set-interval! update-interval update-animations!)
 
     (core/open-window! window)
     (core/enter-loop!)))
@@ -157,11 +157,7 @@
     (vdom/vdom-mount! root app-state ui-component window)
 
     ;; Set up repeating data update timer
-    (letfn [(schedule-update! []
-              (core/add-timer! 18 (fn []
-                                      (update-data!)
-                                      (schedule-update!))))]
-      (schedule-update!))
+    (core/set-interval! 18 update-data!)
 
     ;; Open window and start event loop
     (core/open-window! window)
@@ -200,11 +200,7 @@
     (vdom/vdom-mount! root app-state ui-component window)
 
     ;; 60 FPS target (16.67ms) for ultra-smooth animations
-    (letfn [(schedule-update! []
-              (core/add-timer! 60 (fn []
-                                    (update-data!)
-                                    (schedule-update!))))]
-      (schedule-update!))
+    (core/set-interval! 60 update-data!)
 
     (core/open-window! window)
     (core/enter-loop!)))
@@ -64,11 +64,7 @@
 (defcomponent timer-demo []
   (let [elapsed (ratom 0)]
     ;; Set up timer (runs every second)
-    (hypr/add-timer! 1000
-                     (fn []
-                       (swap! elapsed inc)
-                       ;; Re-schedule
-                       (hypr/add-timer! 1000 #(swap! elapsed inc))))
+    (hypr/set-interval! 1000 #(swap! elapsed inc))
 
     (fn []
       [:column {:gap 10 :margin 20}
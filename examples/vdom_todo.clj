@@ -60,6 +60,19 @@
 (defn cancel-edit! []
   (swap! app-state assoc :editing-id nil :edit-text ""))
 
+;; ===== DELEGATED ROW EVENTS =====
+;; Row buttons carry an integer tag instead of their own click closures:
+;; the list registers one handler, and unchanged rows diff as :keep.
+(defn- row-tag [id action]
+  (+ (* id 2) (case action :edit 0 :remove 1)))
+
+(defn on-row-event [tag _kind _x _y _button]
+  (let [id (quot tag 2)]
+    (if (even? tag)
+      (when-let [todo (first (filter #(= (:id %) id) (:todos @app-state)))]
+        (start-edit! id (:text todo)))
+      (remove-todo! id))))
+
 ;; ===== PURE RENDER FUNCTION =====
 (defn render-app
   "Pure function: state → UI
@@ -100,6 +113,8 @@
 
      ;; Todo list - automatically reconciled!
      [:v-box {:gap 5
+              :on-event on-row-event
+              :event-buttons :left
               :children (for [todo (sort-by :id (:todos state))]
                           (let [editing? (= (:editing-id state) (:id todo))
                                 id (:id todo)
@@ -119,11 +134,11 @@
                                        :font-size 13}]
                                [:button {:label display-text
                                          :size [btn-w 28]
-                                         :on-click (fn [] (start-edit! id (:text todo)))}])
+                                         :event-tag (row-tag id :edit)}])
                              (if-not editing?
                                [:button {:label "X"
                                          :size [45 28]
-                                         :on-click (fn [] (remove-todo! id))}]
+                                         :event-tag (row-tag id :remove)}]
                                [:text {:content "" :font-size 1}])]))}]  ; Placeholder instead of nil!
 
      [:rectangle {:color [0 0 0 0] :border-color [120 150 180 80]
@@ -3,6 +3,10 @@
 #include <hyprutils/math/Vector2D.hpp>
 #include <memory>
 #include <functional>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "hyprclj_scheduler.hpp"
 
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
@@ -23,6 +27,12 @@ extern "C" JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved) {
     return JNI_VERSION_1_8;
 }
 
+// Cross-thread wakeup: Backend.post() queues work on the Java side and pokes
+// this eventfd, which the backend loop watches on the UI thread.
+static int       g_wakeFd       = -1;
+static jobject   g_postTarget   = nullptr;
+static jmethodID g_drainPosted  = nullptr;
+
 // Backend implementation
 extern "C" {
 
@@ -33,6 +43,8 @@ Java_org_hyprclj_bindings_Backend_nativeCreate(JNIEnv* env, jclass clazz) {
         if (!backend) {
             return 0;
         }
+        // Native frame work (coalesced relayouts) is pumped on this backend
+        schedulerAttach(backend);
         // Store as CSharedPointer
         return reinterpret_cast<jlong>(new Hyprutils::Memory::CSharedPointer<IBackend>(backend));
     } catch (const std::exception& e) {
@@ -49,42 +61,42 @@ Java_org_hyprclj_bindings_Backend_nativeEnterLoop(JNIEnv* env, jobject obj, jlon
 }
 
 JNIEXPORT void JNICALL
-Java_org_hyprclj_bindings_Backend_nativeAddTimer(
-    JNIEnv* env, jobject obj, jlong handle, jint timeoutMs, jobject callback) {
-
+Java_org_hyprclj_bindings_Backend_nativeInitPost(JNIEnv* env, jobject obj, jlong handle) {
     auto backend = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(handle);
-    if (!backend) return;
-
-    // Create a global reference to the callback
-    jobject globalCallback = env->NewGlobalRef(callback);
-
-    backend->addTimer(std::chrono::milliseconds(timeoutMs),
-                      [globalCallback](auto timer, void* data) {
-                          JNIEnv* env = getEnv();
-                          jclass runnableClass = env->FindClass("java/lang/Runnable");
-                          jmethodID runMethod = env->GetMethodID(runnableClass, "run", "()V");
-                          env->CallVoidMethod(globalCallback, runMethod);
-                      },
-                      nullptr, false);
-}
+    if (!backend || g_wakeFd >= 0) return;
 
-JNIEXPORT void JNICALL
-Java_org_hyprclj_bindings_Backend_nativeAddIdle(
-    JNIEnv* env, jobject obj, jlong handle, jobject callback) {
+    g_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (g_wakeFd < 0) return;
 
-    auto backend = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(handle);
-    if (!backend) return;
+    g_postTarget  = env->NewGlobalRef(obj);
+    g_drainPosted = env->GetMethodID(env->GetObjectClass(obj), "drainPosted", "()V");
 
-    jobject globalCallback = env->NewGlobalRef(callback);
+    backend->addFd(g_wakeFd, []() {
+        // Reset the counter; one drain handles every post since the last one
+        uint64_t count = 0;
+        while (read(g_wakeFd, &count, sizeof(count)) > 0) {
+        }
 
-    backend->addIdle([globalCallback]() {
         JNIEnv* env = getEnv();
-        jclass runnableClass = env->FindClass("java/lang/Runnable");
-        jmethodID runMethod = env->GetMethodID(runnableClass, "run", "()V");
-        env->CallVoidMethod(globalCallback, runMethod);
+        env->CallVoidMethod(g_postTarget, g_drainPosted);
+        if (env->ExceptionCheck()) {
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+        }
     });
 }
 
+// Safe to call from any thread
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Backend_nativeWakeup(JNIEnv* env, jclass clazz) {
+    if (g_wakeFd < 0) return;
+
+    uint64_t one = 1;
+    if (write(g_wakeFd, &one, sizeof(one)) < 0) {
+        // EAGAIN means the counter is already non-zero - a drain is pending anyway
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Backend_nativeDestroy(JNIEnv* env, jobject obj, jlong handle) {
     auto ptr = reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(handle);
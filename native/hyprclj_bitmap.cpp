@@ -0,0 +1,423 @@
+#include <jni.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <cerrno>
+#include <csignal>
+#include <unistd.h>
+
+#include "hyprclj_bitmap.hpp"
+
+using Hyprutils::Math::Vector2D;
+
+// Bitmap cache
+//
+// Rasterization is plain pixman: rectangles are composited directly,
+// rounded shapes and rings are built from one trapezoid per scanline band
+// and lines from two triangles per segment, all through an a8 mask so edges
+// are antialiased and overlaps within a shape don't blend twice.
+//
+// The LRU is ordered by use: showing a cached bitmap again moves its owner
+// to the front, and when the total goes over budget the owners at the back
+// are told to drop their bitmaps (they fall back to drawing live).
+//
+// Files are named <pid>-<n>.png, one per owner. A raster writes a temporary
+// file and renames it over the owner's, so the image element never reads a
+// half-written PNG and the directory holds one file per cached owner.
+namespace {
+
+struct SBitmapCache {
+    std::list<IBitmapOwner*>                                                        lru; // front = most recent
+    std::unordered_map<IBitmapOwner*, std::pair<std::list<IBitmapOwner*>::iterator, size_t>> entries;
+
+    size_t   bytes  = 0;
+    size_t   budget = 32 * 1024 * 1024;
+    uint64_t hits = 0, rasterized = 0, evictions = 0;
+};
+
+SBitmapCache                                   g_bitmaps;
+std::unordered_map<IBitmapOwner*, std::string> g_files;
+uint64_t                                       g_fileSeq = 0;
+bool                                           g_swept   = false;
+double                                         g_scale   = 1.0;
+
+pixman_color_t premultiplied(uint32_t rgba) {
+    const uint32_t a = rgba & 0xFF;
+    auto channel = [a](uint32_t c) { return (uint16_t)((c * a / 255) * 257); };
+    return {channel((rgba >> 24) & 0xFF), channel((rgba >> 16) & 0xFF), channel((rgba >> 8) & 0xFF), (uint16_t)(a * 257)};
+}
+
+pixman_point_fixed_t fixedPoint(double x, double y) {
+    return {pixman_double_to_fixed(x), pixman_double_to_fixed(y)};
+}
+
+pixman_trapezoid_t band(double top, double bottom, double leftTop, double leftBottom, double rightTop, double rightBottom) {
+    pixman_trapezoid_t trap;
+    trap.top   = pixman_double_to_fixed(top);
+    trap.bottom = pixman_double_to_fixed(bottom);
+    trap.left  = {fixedPoint(leftTop, top), fixedPoint(leftBottom, bottom)};
+    trap.right = {fixedPoint(rightTop, top), fixedPoint(rightBottom, bottom)};
+    return trap;
+}
+
+// A rounded rectangle, as the horizontal extent of each scanline
+struct SRoundedRect {
+    double x0 = 0, y0 = 0, x1 = 0, y1 = 0, r = 0;
+
+    bool covers(double y) const {
+        return y >= y0 && y <= y1 && x1 > x0;
+    }
+
+    double inset(double y) const {
+        double dy = 0;
+        if (y < y0 + r) dy = y0 + r - y;
+        else if (y > y1 - r) dy = y - (y1 - r);
+        else return 0;
+        return r - std::sqrt(std::max(0.0, r * r - dy * dy));
+    }
+};
+
+// Scanline band edges: one pixel apart through the corners, one band for
+// the straight middle
+std::vector<double> bandEdges(const SRoundedRect& outer, const SRoundedRect& inner) {
+    std::vector<double> edges = {outer.y0, outer.y1, inner.y0, inner.y1};
+    const double        curve = std::max(outer.r, inner.y0 - outer.y0 + inner.r);
+    for (double y = outer.y0; y < outer.y0 + curve; y += 1) edges.push_back(y);
+    for (double y = outer.y1; y > outer.y1 - curve; y -= 1) edges.push_back(y);
+
+    std::erase_if(edges, [&outer](double y) { return y < outer.y0 || y > outer.y1; });
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    return edges;
+}
+
+// Trapezoids covering outer minus inner (inner may be empty)
+std::vector<pixman_trapezoid_t> shapeBands(const SRoundedRect& outer, const SRoundedRect& inner, bool hollow) {
+    std::vector<pixman_trapezoid_t> traps;
+    const auto                      edges = bandEdges(outer, inner);
+
+    for (size_t i = 0; i + 1 < edges.size(); ++i) {
+        const double top = edges[i], bottom = edges[i + 1], mid = (top + bottom) / 2;
+        const double olt = outer.x0 + outer.inset(top), olb = outer.x0 + outer.inset(bottom);
+        const double ort = outer.x1 - outer.inset(top), orb = outer.x1 - outer.inset(bottom);
+
+        if (!hollow || !inner.covers(mid)) {
+            traps.push_back(band(top, bottom, olt, olb, ort, orb));
+            continue;
+        }
+
+        const double ilt = inner.x0 + inner.inset(top), ilb = inner.x0 + inner.inset(bottom);
+        const double irt = inner.x1 - inner.inset(top), irb = inner.x1 - inner.inset(bottom);
+        traps.push_back(band(top, bottom, olt, olb, ilt, ilb));
+        traps.push_back(band(top, bottom, irt, irb, ort, orb));
+    }
+    return traps;
+}
+
+void evictOverBudget(IBitmapOwner* keep) {
+    auto& c = g_bitmaps;
+    while (c.bytes > c.budget) {
+        // Least recently used first, never the bitmap being added
+        auto it = std::find_if(c.lru.rbegin(), c.lru.rend(), [keep](IBitmapOwner* owner) { return owner != keep; });
+        if (it == c.lru.rend()) break;
+
+        IBitmapOwner* victim = *it;
+        bitmapCacheForget(victim);
+        c.evictions++;
+        victim->evictBitmap();
+    }
+}
+
+// PNG with stored (uncompressed) deflate blocks: nothing to link, and the
+// file is read back once per raster from the runtime directory
+void putBE32(std::vector<uint8_t>& out, uint32_t v) {
+    out.insert(out.end(), {(uint8_t)(v >> 24), (uint8_t)(v >> 16), (uint8_t)(v >> 8), (uint8_t)v});
+}
+
+uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0) {
+    static const auto table = [] {
+        std::array<uint32_t, 256> t{};
+        for (uint32_t n = 0; n < 256; ++n) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; ++k) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[n] = c;
+        }
+        return t;
+    }();
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+void putChunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+    putBE32(out, (uint32_t)data.size());
+    const size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    putBE32(out, crc32(out.data() + start, out.size() - start));
+}
+
+std::vector<uint8_t> encodePng(int width, int height, const std::vector<uint32_t>& pixels) {
+    // Raw scanlines: filter byte 0, then straight (non-premultiplied) RGBA
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)height * (1 + (size_t)width * 4));
+    for (int y = 0; y < height; ++y) {
+        raw.push_back(0);
+        for (int x = 0; x < width; ++x) {
+            const uint32_t p = pixels[(size_t)y * width + x];
+            const uint32_t a = p >> 24;
+            auto straight = [a](uint32_t c) { return (uint8_t)(a ? std::min<uint32_t>(255, c * 255 / a) : 0); };
+            raw.insert(raw.end(), {straight((p >> 16) & 0xFF), straight((p >> 8) & 0xFF), straight(p & 0xFF), (uint8_t)a});
+        }
+    }
+
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    for (size_t at = 0; at < raw.size() || at == 0; at += 65535) {
+        const size_t   len  = std::min<size_t>(65535, raw.size() - at);
+        const bool     last = at + len >= raw.size();
+        const uint16_t n    = (uint16_t)len;
+        zlib.insert(zlib.end(), {(uint8_t)(last ? 1 : 0), (uint8_t)n, (uint8_t)(n >> 8), (uint8_t)~n, (uint8_t)(~n >> 8)});
+        zlib.insert(zlib.end(), raw.begin() + at, raw.begin() + at + len);
+        if (last) break;
+    }
+    uint32_t s1 = 1, s2 = 0;
+    for (uint8_t b : raw) {
+        s1 = (s1 + b) % 65521;
+        s2 = (s2 + s1) % 65521;
+    }
+    putBE32(zlib, (s2 << 16) | s1);
+
+    std::vector<uint8_t> header;
+    putBE32(header, (uint32_t)width);
+    putBE32(header, (uint32_t)height);
+    header.insert(header.end(), {8, 6, 0, 0, 0}); // 8-bit RGBA
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    putChunk(png, "IHDR", header);
+    putChunk(png, "IDAT", zlib);
+    putChunk(png, "IEND", {});
+    return png;
+}
+
+std::filesystem::path cacheDir() {
+    const char* runtime = std::getenv("XDG_RUNTIME_DIR");
+    return std::filesystem::path(runtime && *runtime ? runtime : "/tmp") / "hyprclj-bitmaps";
+}
+
+// Remove files of processes that are gone (crashed or killed before their
+// owners were destroyed)
+void sweepStaleFiles(const std::filesystem::path& dir) {
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        const auto name = entry.path().filename().string();
+        char*      end  = nullptr;
+        const long pid  = std::strtol(name.c_str(), &end, 10);
+        if (end == name.c_str() || *end != '-' || pid <= 0 || pid == (long)getpid()) continue;
+        if (kill((pid_t)pid, 0) == 0 || errno == EPERM) continue;
+
+        std::error_code removeEc;
+        std::filesystem::remove(entry.path(), removeEc);
+    }
+}
+
+} // namespace
+
+// ===== CBitmap =====
+
+CBitmap::CBitmap(int width, int height, double scale) : m_width(std::max(width, 1)), m_height(std::max(height, 1)), m_scale(scale > 0 ? scale : 1.0) {
+    m_pixels.assign((size_t)m_width * m_height, 0);
+    m_image = pixman_image_create_bits(PIXMAN_a8r8g8b8, m_width, m_height, m_pixels.data(), m_width * 4);
+}
+
+CBitmap::~CBitmap() {
+    if (m_image) {
+        pixman_image_unref(m_image);
+    }
+}
+
+void CBitmap::fillRect(double x, double y, double w, double h, uint32_t color, double rounding, uint32_t borderColor, double border) {
+    if (!m_image || w <= 0 || h <= 0) return;
+
+    x *= m_scale, y *= m_scale, w *= m_scale, h *= m_scale;
+    rounding *= m_scale, border *= m_scale;
+    border                   = std::clamp(border, 0.0, std::min(w, h) / 2);
+    rounding                 = std::clamp(rounding, 0.0, std::min(w, h) / 2);
+    const SRoundedRect outer = {x, y, x + w, y + h, rounding};
+    const SRoundedRect inner = {x + border, y + border, x + w - border, y + h - border, std::max(0.0, rounding - border)};
+
+    auto paint = [this](uint32_t rgba, const std::vector<pixman_trapezoid_t>& traps) {
+        if (!(rgba & 0xFF) || traps.empty()) return;
+        const pixman_color_t c     = premultiplied(rgba);
+        pixman_image_t*      solid = pixman_image_create_solid_fill(&c);
+        pixman_composite_trapezoids(PIXMAN_OP_OVER, solid, m_image, PIXMAN_a8, 0, 0, 0, 0, (int)traps.size(), traps.data());
+        pixman_image_unref(solid);
+    };
+
+    paint(color, shapeBands(border > 0 ? inner : outer, {}, false));
+    if (border > 0) {
+        paint(borderColor, shapeBands(outer, inner, true));
+    }
+}
+
+void CBitmap::polyline(const std::vector<Vector2D>& points, uint32_t color, double thickness) {
+    if (!m_image || points.size() < 2 || !(color & 0xFF)) return;
+
+    const double                   half = std::max(thickness, 1.0) * m_scale / 2;
+    std::vector<pixman_triangle_t> tris;
+    tris.reserve((points.size() - 1) * 2);
+
+    for (size_t i = 0; i + 1 < points.size(); ++i) {
+        const Vector2D p = {points[i].x * m_scale, points[i].y * m_scale};
+        const Vector2D q = {points[i + 1].x * m_scale, points[i + 1].y * m_scale};
+        const double   len = std::hypot(q.x - p.x, q.y - p.y);
+        if (len <= 0) continue;
+
+        // Square caps half a thickness long close the joins
+        const double   dx = (q.x - p.x) / len * half, dy = (q.y - p.y) / len * half;
+        const Vector2D a = {p.x - dx - dy, p.y - dy + dx}, b = {q.x + dx - dy, q.y + dy + dx};
+        const Vector2D c = {q.x + dx + dy, q.y + dy - dx}, d = {p.x - dx + dy, p.y - dy - dx};
+
+        tris.push_back({fixedPoint(a.x, a.y), fixedPoint(b.x, b.y), fixedPoint(c.x, c.y)});
+        tris.push_back({fixedPoint(a.x, a.y), fixedPoint(c.x, c.y), fixedPoint(d.x, d.y)});
+    }
+    if (tris.empty()) return;
+
+    const pixman_color_t c     = premultiplied(color);
+    pixman_image_t*      solid = pixman_image_create_solid_fill(&c);
+    pixman_composite_triangles(PIXMAN_OP_OVER, solid, m_image, PIXMAN_a8, 0, 0, 0, 0, (int)tris.size(), tris.data());
+    pixman_image_unref(solid);
+}
+
+bool CBitmap::writePng(const std::string& path) const {
+    if (path.empty()) return false;
+
+    const std::string temp = path + ".tmp";
+    const auto        png  = encodePng(m_width, m_height, m_pixels);
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out.write(reinterpret_cast<const char*>(png.data()), (std::streamsize)png.size())) return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp, path, ec);
+    if (ec) std::filesystem::remove(temp, ec);
+    return !ec;
+}
+
+size_t CBitmap::bytes() const {
+    return m_pixels.size() * sizeof(uint32_t);
+}
+
+int CBitmap::width() const {
+    return m_width;
+}
+
+int CBitmap::height() const {
+    return m_height;
+}
+
+// ===== LRU =====
+
+bool bitmapCacheUse(IBitmapOwner* owner, size_t bytes) {
+    auto& c = g_bitmaps;
+    if (bytes > c.budget) {
+        bitmapCacheForget(owner);
+        return false;
+    }
+
+    auto it = c.entries.find(owner);
+    if (it != c.entries.end()) {
+        c.bytes -= it->second.second;
+        c.lru.erase(it->second.first);
+    }
+    c.lru.push_front(owner);
+    c.entries[owner] = {c.lru.begin(), bytes};
+    c.bytes += bytes;
+
+    evictOverBudget(owner);
+    return true;
+}
+
+void bitmapCacheForget(IBitmapOwner* owner) {
+    auto& c  = g_bitmaps;
+    auto  it = c.entries.find(owner);
+    if (it == c.entries.end()) return;
+
+    c.bytes -= it->second.second;
+    c.lru.erase(it->second.first);
+    c.entries.erase(it);
+}
+
+const std::string& bitmapFileFor(IBitmapOwner* owner) {
+    static const std::string none;
+
+    auto it = g_files.find(owner);
+    if (it != g_files.end()) return it->second;
+
+    std::error_code ec;
+    const auto      dir = cacheDir();
+    std::filesystem::create_directories(dir, ec);
+    if (ec) return none;
+
+    if (!g_swept) {
+        g_swept = true;
+        sweepStaleFiles(dir);
+    }
+
+    const auto path = dir / (std::to_string(getpid()) + "-" + std::to_string(++g_fileSeq) + ".png");
+    return g_files.emplace(owner, path.string()).first->second;
+}
+
+void bitmapFileRelease(IBitmapOwner* owner) {
+    auto it = g_files.find(owner);
+    if (it == g_files.end()) return;
+
+    std::error_code ec;
+    std::filesystem::remove(it->second, ec);
+    g_files.erase(it);
+}
+
+void bitmapSetScale(double scale) {
+    if (scale > 0) g_scale = scale;
+}
+
+double bitmapScale() {
+    return g_scale;
+}
+
+void bitmapCacheNoteHit() {
+    g_bitmaps.hits++;
+}
+
+void bitmapCacheNoteRaster() {
+    g_bitmaps.rasterized++;
+}
+
+extern "C" {
+
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Element_nativeBitmapCacheStats(JNIEnv* env, jclass clazz) {
+    const auto& c         = g_bitmaps;
+    const jlong values[6] = {(jlong)c.entries.size(), (jlong)c.bytes, (jlong)c.budget,
+                             (jlong)c.hits,           (jlong)c.rasterized, (jlong)c.evictions};
+
+    jlongArray result = env->NewLongArray(6);
+    env->SetLongArrayRegion(result, 0, 6, values);
+    return result;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetBitmapCacheBudget(JNIEnv* env, jclass clazz, jlong bytes) {
+    if (bytes < 0) return;
+    g_bitmaps.budget = (size_t)bytes;
+    evictOverBudget(nullptr);
+}
+
+} // extern "C"
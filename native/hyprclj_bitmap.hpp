@@ -0,0 +1,73 @@
+#pragma once
+
+#include <pixman.h>
+#include <hyprutils/math/Vector2D.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Bitmap cache (hyprclj_bitmap.cpp)
+//
+// A software rasterizer on pixman for content cached as a bitmap, and the
+// LRU that keeps the cached bitmaps under a memory budget. hyprtoolkit
+// shows images from files, so a finished bitmap is written out as an
+// uncompressed PNG and displayed by one image element. Each owner has one
+// file that every raster overwrites.
+
+// Something holding a cached bitmap; told to drop it when evicted
+class IBitmapOwner {
+  public:
+    virtual ~IBitmapOwner()   = default;
+    virtual void evictBitmap() = 0;
+};
+
+class CBitmap {
+  public:
+    // width x height pixels; drawing coordinates are multiplied by scale
+    // (the window scale, so cached content is as sharp as live drawing)
+    CBitmap(int width, int height, double scale = 1.0);
+    ~CBitmap();
+
+    CBitmap(const CBitmap&)            = delete;
+    CBitmap& operator=(const CBitmap&) = delete;
+
+    // Colors are packed 0xRRGGBBAA, like everywhere else in the bindings
+    void fillRect(double x, double y, double w, double h, uint32_t color, double rounding, uint32_t borderColor, double border);
+    void polyline(const std::vector<Hyprutils::Math::Vector2D>& points, uint32_t color, double thickness);
+
+    // Write the bitmap as a PNG to path, replacing what was there
+    bool writePng(const std::string& path) const;
+
+    size_t bytes() const;
+    int    width() const;
+    int    height() const;
+
+  private:
+    int                   m_width = 0, m_height = 0;
+    double                m_scale = 1.0;
+    std::vector<uint32_t> m_pixels; // premultiplied a8r8g8b8
+    pixman_image_t*       m_image = nullptr;
+};
+
+// Account a cached bitmap to its owner and mark it most recently used.
+// Evicts least recently used bitmaps of other owners to stay in budget;
+// returns false when the bitmap alone exceeds the budget (not cached).
+bool bitmapCacheUse(IBitmapOwner* owner, size_t bytes);
+void bitmapCacheForget(IBitmapOwner* owner);
+
+// The PNG file an owner's bitmaps are written to. It lives from the first
+// call until bitmapFileRelease (evicted, uncached or destroyed owner), and
+// files left behind by dead processes are removed on first use. Empty when
+// the directory can't be created.
+const std::string& bitmapFileFor(IBitmapOwner* owner);
+void               bitmapFileRelease(IBitmapOwner* owner);
+
+// Scale bitmaps are rasterized at: the scale of the latest window opened
+// or resized (hyprclj_window.cpp)
+void   bitmapSetScale(double scale);
+double bitmapScale();
+
+// A cached bitmap was shown again instead of redrawing its content
+void bitmapCacheNoteHit();
+void bitmapCacheNoteRaster();
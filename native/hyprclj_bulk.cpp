@@ -0,0 +1,79 @@
+#include <jni.h>
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "hyprclj_bulk.hpp"
+#include "hyprclj_layout.hpp"
+#include "hyprclj_mouse.hpp"
+#include "hyprclj_pool.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::Vector2D;
+
+// Bulk construction
+//
+// Building a large table one element at a time costs a JNI crossing with a
+// dozen arguments per element, plus a relayout of a placed native container
+// per added child. A batch reads its columns in place (direct buffers, no
+// copies), creates every element through the same code as the single
+// builders (so pooling, palette and measurement caching all apply), and
+// hands the children to the parent's layout at once.
+
+CIntColumn::CIntColumn(JNIEnv* env, jobject buffer, jint count, const char* name) {
+    if (!buffer || count <= 0 || env->ExceptionCheck()) return;
+
+    auto* data = static_cast<const jint*>(env->GetDirectBufferAddress(buffer));
+    if (!data || env->GetDirectBufferCapacity(buffer) < count) {
+        const std::string message = std::string(name) + ": expected a direct buffer of at least " + std::to_string(count) + " ints";
+        bulkThrow(env, message.c_str());
+        return;
+    }
+    m_data = data;
+}
+
+void bulkThrow(JNIEnv* env, const char* message) {
+    env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), message);
+}
+
+jlongArray bulkFinish(JNIEnv* env, jlong parentHandle, const std::vector<jlong>& handles, const CIntColumn& xs, const CIntColumn& ys) {
+    // All or nothing: a partly built batch would leave elements attached
+    // that Java has no handle for
+    if (std::ranges::find(handles, 0) != handles.end()) {
+        for (jlong handle : handles) {
+            if (handle) poolRelease(handle);
+        }
+        env->ThrowNew(env->FindClass("java/lang/RuntimeException"), "Failed to create batch element");
+        return nullptr;
+    }
+
+    const bool                                               absolute = xs.present() && ys.present();
+    std::vector<Hyprutils::Memory::CSharedPointer<IElement>> children;
+    children.reserve(handles.size());
+
+    for (size_t i = 0; i < handles.size(); ++i) {
+        auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handles[i]);
+        if (absolute) {
+            element->setPositionMode(IElement::HT_POSITION_ABSOLUTE);
+            element->setAbsolutePosition(Vector2D{(double)xs.at(i, 0), (double)ys.at(i, 0)});
+        }
+        children.push_back(std::move(element));
+    }
+
+    if (parentHandle) {
+        auto parent = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(parentHandle);
+        if (parent && !children.empty()) {
+            for (const auto& child : children) {
+                parent->addChild(child);
+                mouseChildAdded(parent, child);
+            }
+            layoutChildrenAdded(parent, children);
+        }
+    }
+
+    jlongArray result = env->NewLongArray((jsize)handles.size());
+    env->SetLongArrayRegion(result, 0, (jsize)handles.size(), handles.data());
+    return result;
+}
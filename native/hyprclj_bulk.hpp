@@ -0,0 +1,42 @@
+#pragma once
+
+#include <jni.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Bulk construction (hyprclj_bulk.cpp)
+//
+// createMany entry points take a batch as columns: one direct int buffer per
+// field (Columns.java), each holding one value per element. A missing (null)
+// column means every element gets the field's default; a column that is not
+// direct or holds fewer than count values throws IllegalArgumentException.
+// The elements are created in one native call, optionally attached to a
+// parent in one go, and returned as an array of handles.
+
+class CIntColumn {
+  public:
+    // null is a missing column; a non-direct or too short buffer throws
+    // IllegalArgumentException (check env->ExceptionCheck() before use)
+    CIntColumn(JNIEnv* env, jobject buffer, jint count, const char* name);
+
+    bool present() const {
+        return m_data != nullptr;
+    }
+
+    jint at(size_t i, jint fallback) const {
+        return m_data ? m_data[i] : fallback;
+    }
+
+  private:
+    const jint* m_data = nullptr;
+};
+
+// Throw IllegalArgumentException with message
+void bulkThrow(JNIEnv* env, const char* message);
+
+// Attach the created elements to the parent (0 = none) with one relayout,
+// placing them absolutely when both position columns are given, and return
+// the handles to Java. If any create failed (0 handle), nothing is attached:
+// the created elements are released and a RuntimeException is thrown.
+jlongArray bulkFinish(JNIEnv* env, jlong parentHandle, const std::vector<jlong>& handles, const CIntColumn& xs, const CIntColumn& ys);
@@ -3,6 +3,11 @@
 #include <hyprutils/math/Vector2D.hpp>
 #include <string>
 
+#include "hyprclj_mouse.hpp"
+#include "hyprclj_layout.hpp"
+#include "hyprclj_pool.hpp"
+#include "hyprclj_strings.hpp"
+
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
 
@@ -14,15 +19,21 @@ extern "C" {
 JNIEXPORT jlong JNICALL
 Java_org_hyprclj_bindings_Button_00024Builder_nativeCreate(
     JNIEnv* env, jclass clazz,
-    jstring label, jint width, jint height,
+    jstring label, jint labelId, jint width, jint height,
     jboolean noBorder, jboolean noBg, jint fontSize) {
 
     try {
-        const char* labelChars = env->GetStringUTFChars(label, nullptr);
-        std::string labelStr(labelChars);
-        env->ReleaseStringUTFChars(label, labelChars);
+        // Repeated labels arrive interned (Strings.intern)
+        std::string labelStr = stringArg(env, label, labelId);
+
+        const bool hasSize = sizeSpecified(width, height);
 
-        auto builder = CButtonBuilder::begin();
+        // Reuse a parked button of the same shape when there is one
+        const uint32_t key    = poolKey(POOL_BUTTON, (noBorder ? 1 : 0) | (noBg ? 2 : 0) | (hasSize ? 4 : 0));
+        const jlong    pooled = poolAcquire(key);
+        auto pooledButton = pooled ? *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CButtonElement>*>(pooled) : nullptr;
+
+        auto builder = pooledButton ? pooledButton->rebuild() : CButtonBuilder::begin();
         builder->label(std::move(labelStr));
         builder->fontSize(CFontSize(CFontSize::HT_FONT_ABSOLUTE, (float)fontSize));
 
@@ -33,18 +44,22 @@ Java_org_hyprclj_bindings_Button_00024Builder_nativeCreate(
             builder->noBg(true);
         }
 
-        if (width > 0 && height > 0) {
-            builder->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      Vector2D{(double)width, (double)height}));
+        if (hasSize) {
+            builder->size(sizeFromSpec(width, height));
         }
 
         auto button = builder->commence();
+        sizeNoteFill(button, width, height);
+        if (pooled) {
+            return pooled;
+        }
         if (!button) {
             return 0;
         }
 
-        return reinterpret_cast<jlong>(new auto(button));
+        jlong handle = reinterpret_cast<jlong>(new auto(button));
+        poolTrack(handle, key);
+        return handle;
     } catch (const std::exception& e) {
         return 0;
     }
@@ -57,17 +72,8 @@ Java_org_hyprclj_bindings_Button_00024Builder_nativeSetClickCallback(
     auto button = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
     if (!button) return;
 
-    jobject globalCallback = env->NewGlobalRef(callback);
-
-    button->setReceivesMouse(true);
-    button->setMouseButton([globalCallback](Input::eMouseButton btn, bool pressed) {
-        if (pressed && btn == Input::MOUSE_BUTTON_LEFT) {
-            JNIEnv* env = getEnv();
-            jclass runnableClass = env->FindClass("java/lang/Runnable");
-            jmethodID runMethod = env->GetMethodID(runnableClass, "run", "()V");
-            env->CallVoidMethod(globalCallback, runMethod);
-        }
-    });
+    // Click and right-click share the element's mouse dispatcher
+    mouseAddHandler(env, button, 1 << MOUSE_PRESS, MOUSE_BUTTON_BIT_LEFT, MOUSE_CALL_RUNNABLE, callback);
 }
 
 JNIEXPORT void JNICALL
@@ -77,17 +83,8 @@ Java_org_hyprclj_bindings_Button_00024Builder_nativeSetRightClickCallback(
     auto button = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
     if (!button) return;
 
-    jobject globalCallback = env->NewGlobalRef(callback);
-
-    button->setReceivesMouse(true);
-    button->setMouseButton([globalCallback](Input::eMouseButton btn, bool pressed) {
-        if (pressed && btn == Input::MOUSE_BUTTON_RIGHT) {
-            JNIEnv* env = getEnv();
-            jclass runnableClass = env->FindClass("java/lang/Runnable");
-            jmethodID runMethod = env->GetMethodID(runnableClass, "run", "()V");
-            env->CallVoidMethod(globalCallback, runMethod);
-        }
-    });
+    // Click and right-click share the element's mouse dispatcher
+    mouseAddHandler(env, button, 1 << MOUSE_PRESS, MOUSE_BUTTON_BIT_RIGHT, MOUSE_CALL_RUNNABLE, callback);
 }
 
 JNIEXPORT void JNICALL
@@ -0,0 +1,639 @@
+#include <jni.h>
+#include <hyprtoolkit/core/CoreMacros.hpp>  // Must be included first for HT_HIDDEN
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprtoolkit/element/Image.hpp>
+#include <hyprtoolkit/element/Line.hpp>
+#include <hyprtoolkit/element/Rectangle.hpp>
+#include <hyprtoolkit/element/Text.hpp>
+#include <hyprtoolkit/palette/Color.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <hyprutils/math/Box.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hyprclj_bitmap.hpp"
+#include "hyprclj_layout.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::CBox;
+using Hyprutils::Math::Vector2D;
+
+// Canvas
+//
+// One element that draws a display list: rects (optionally rounded and
+// bordered), polylines and text runs, under a clip and a translate / scale
+// transform with save / restore. Java encodes the list into one binary
+// buffer (DisplayList) and uploads it in a single call, replacing either
+// the whole list or a range of commands.
+//
+// hyprtoolkit only paints through elements, so each drawing command is
+// backed by a rectangle, line or text primitive owned by the canvas. The
+// commands are resolved against transform and clip into draw ops, and the
+// new ops are diffed against the previous ones by index: unchanged ops keep
+// their primitive untouched, changed ones rebuild it in place, and
+// primitives freed by a shorter list are kept for reuse. A chart redrawn
+// with new data rebuilds its series and leaves its grid and axes alone.
+//
+// Cached as a bitmap, the rects and lines are rasterized once with pixman
+// at the window scale and shown by a single image under the (still live)
+// text, until the commands, the canvas size or the scale change. Bitmaps are held in a budgeted LRU
+// (hyprclj_bitmap.cpp); an evicted canvas draws live again until its next
+// change.
+//
+// Buffer format, native-endian 32-bit words: each command is a header word
+// (opcode << 24 | payload word count) followed by its payload.
+namespace {
+
+// Keep in sync with DisplayList.OP_*
+enum eCanvasOp : uint32_t {
+    OP_RECT = 1,  // x y w h color rounding borderColor border
+    OP_POLYLINE,  // color thickness (x y)*
+    OP_TEXT,      // x y color fontSize byteLength utf8...
+    OP_CLIP,      // x y w h
+    OP_SAVE,
+    OP_RESTORE,
+    OP_TRANSLATE, // dx dy
+    OP_SCALE,     // sx sy
+};
+
+enum ePrimitive : int {
+    PRIM_RECT = 0,
+    PRIM_LINE,
+    PRIM_TEXT,
+    PRIM_COUNT,
+};
+
+struct SCommand {
+    uint32_t              op = 0;
+    std::vector<uint32_t> words;
+};
+
+// A drawing command resolved against the transform and clip in effect, in
+// canvas coordinates
+struct SDrawOp {
+    ePrimitive            kind = PRIM_RECT;
+    double                x = 0, y = 0, w = 0, h = 0;
+    uint32_t              color = 0, borderColor = 0;
+    int                   rounding = 0, border = 0, thickness = 1;
+    float                 fontSize = 0;
+    std::vector<Vector2D> points;
+    std::string           text;
+
+    bool operator==(const SDrawOp&) const = default;
+};
+
+struct SPrimitive {
+    ePrimitive                                         kind = PRIM_RECT;
+    Hyprutils::Memory::CSharedPointer<CRectangleElement> rect;
+    Hyprutils::Memory::CSharedPointer<CLineElement>      line;
+    Hyprutils::Memory::CSharedPointer<CTextElement>      text;
+
+    Hyprutils::Memory::CSharedPointer<IElement> element() const {
+        switch (kind) {
+            case PRIM_RECT: return rect;
+            case PRIM_LINE: return line;
+            default: return text;
+        }
+    }
+};
+
+CHyprColor unpackColor(uint32_t rgba) {
+    return CHyprColor{(float)((rgba >> 24) & 0xFF) / 255.0f, (float)((rgba >> 16) & 0xFF) / 255.0f,
+                      (float)((rgba >> 8) & 0xFF) / 255.0f, (float)(rgba & 0xFF) / 255.0f};
+}
+
+float wordFloat(uint32_t word) {
+    float value;
+    std::memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+// Split a buffer into commands; a truncated trailing command is dropped
+std::vector<SCommand> parseCommands(const uint8_t* data, size_t length) {
+    std::vector<SCommand> commands;
+    const size_t          count = length / sizeof(uint32_t);
+
+    size_t at = 0;
+    while (at < count) {
+        uint32_t header;
+        std::memcpy(&header, data + at * sizeof(uint32_t), sizeof(header));
+        const size_t payload = header & 0xFFFFFF;
+        if (at + 1 + payload > count) break;
+
+        SCommand command{header >> 24, std::vector<uint32_t>(payload)};
+        std::memcpy(command.words.data(), data + (at + 1) * sizeof(uint32_t), payload * sizeof(uint32_t));
+        commands.push_back(std::move(command));
+        at += 1 + payload;
+    }
+    return commands;
+}
+
+struct SDrawState {
+    double tx = 0, ty = 0, sx = 1, sy = 1;
+    bool   clipped = false;
+    double clipX0 = 0, clipY0 = 0, clipX1 = 0, clipY1 = 0;
+
+    Vector2D apply(double x, double y) const {
+        return {tx + x * sx, ty + y * sy};
+    }
+};
+
+// Run the commands through the state machine. Rects are cut to the clip;
+// lines and text can't be cut, so they are culled when fully outside it.
+std::vector<SDrawOp> resolveCommands(const std::vector<SCommand>& commands) {
+    std::vector<SDrawOp>    ops;
+    SDrawState              state;
+    std::vector<SDrawState> stack;
+
+    auto outside = [&state](double x0, double y0, double x1, double y1) {
+        return state.clipped && (x1 < state.clipX0 || y1 < state.clipY0 || x0 > state.clipX1 || y0 > state.clipY1);
+    };
+
+    for (const auto& command : commands) {
+        const auto& w = command.words;
+        auto        f = [&w](size_t i) { return (double)wordFloat(w[i]); };
+
+        switch (command.op) {
+            case OP_RECT: {
+                if (w.size() < 8) break;
+                const Vector2D a = state.apply(f(0), f(1)), b = state.apply(f(0) + f(2), f(1) + f(3));
+                double         x0 = std::min(a.x, b.x), y0 = std::min(a.y, b.y), x1 = std::max(a.x, b.x), y1 = std::max(a.y, b.y);
+                if (state.clipped) {
+                    x0 = std::max(x0, state.clipX0);
+                    y0 = std::max(y0, state.clipY0);
+                    x1 = std::min(x1, state.clipX1);
+                    y1 = std::min(y1, state.clipY1);
+                }
+                if (x1 <= x0 || y1 <= y0) break;
+
+                const double scale = std::min(std::abs(state.sx), std::abs(state.sy));
+                SDrawOp      op;
+                op.kind        = PRIM_RECT;
+                op.x           = x0;
+                op.y           = y0;
+                op.w           = x1 - x0;
+                op.h           = y1 - y0;
+                op.color       = w[4];
+                op.rounding    = (int)std::round(f(5) * scale);
+                op.borderColor = w[6];
+                op.border      = (int)std::round(f(7) * scale);
+                ops.push_back(std::move(op));
+                break;
+            }
+            case OP_POLYLINE: {
+                if (w.size() < 6) break;
+                SDrawOp op;
+                op.kind      = PRIM_LINE;
+                op.color     = w[0];
+                op.thickness = std::max(1, (int)std::round(f(1)));
+
+                double x0 = INFINITY, y0 = INFINITY, x1 = -INFINITY, y1 = -INFINITY;
+                for (size_t i = 2; i + 1 < w.size(); i += 2) {
+                    const Vector2D p = state.apply(f(i), f(i + 1));
+                    x0 = std::min(x0, p.x), y0 = std::min(y0, p.y), x1 = std::max(x1, p.x), y1 = std::max(y1, p.y);
+                    op.points.push_back(p);
+                }
+                if (outside(x0, y0, x1, y1)) break;
+                ops.push_back(std::move(op));
+                break;
+            }
+            case OP_TEXT: {
+                if (w.size() < 5) break;
+                const size_t bytes = std::min<size_t>(w[4], (w.size() - 5) * sizeof(uint32_t));
+                const Vector2D at  = state.apply(f(0), f(1));
+                if (outside(at.x, at.y, at.x, at.y)) break;
+
+                SDrawOp op;
+                op.kind     = PRIM_TEXT;
+                op.x        = at.x;
+                op.y        = at.y;
+                op.color    = w[2];
+                op.fontSize = (float)(f(3) * std::abs(state.sy));
+                op.text.assign(reinterpret_cast<const char*>(w.data() + 5), bytes);
+                ops.push_back(std::move(op));
+                break;
+            }
+            case OP_CLIP: {
+                if (w.size() < 4) break;
+                const Vector2D a = state.apply(f(0), f(1)), b = state.apply(f(0) + f(2), f(1) + f(3));
+                double         x0 = std::min(a.x, b.x), y0 = std::min(a.y, b.y), x1 = std::max(a.x, b.x), y1 = std::max(a.y, b.y);
+                if (state.clipped) {
+                    x0 = std::max(x0, state.clipX0), y0 = std::max(y0, state.clipY0);
+                    x1 = std::min(x1, state.clipX1), y1 = std::min(y1, state.clipY1);
+                }
+                state.clipped = true;
+                state.clipX0 = x0, state.clipY0 = y0, state.clipX1 = x1, state.clipY1 = y1;
+                break;
+            }
+            case OP_SAVE: stack.push_back(state); break;
+            case OP_RESTORE:
+                if (!stack.empty()) {
+                    state = stack.back();
+                    stack.pop_back();
+                }
+                break;
+            case OP_TRANSLATE:
+                if (w.size() < 2) break;
+                state.tx += f(0) * state.sx;
+                state.ty += f(1) * state.sy;
+                break;
+            case OP_SCALE:
+                if (w.size() < 2) break;
+                state.sx *= f(0);
+                state.sy *= f(1);
+                break;
+            default: break;
+        }
+    }
+    return ops;
+}
+
+class CCanvasElement : public IElement, public IBitmapOwner {
+  public:
+    ~CCanvasElement() override {
+        bitmapCacheForget(this);
+        bitmapFileRelease(this);
+        layoutForgetElement(this);
+    }
+
+    void paint() override {
+        // Primitives paint themselves
+    }
+
+    void reposition(const CBox& box, const Vector2D& maxSize = {-1, -1}) override {
+        IElement::reposition(box, maxSize);
+        m_box    = box;
+        m_placed = true;
+
+        // Line points are relative to the canvas size
+        if (canvasSize() != m_lineSize) {
+            rebuildLines();
+        }
+        place();
+    }
+
+    std::optional<Vector2D> preferredSize(const Vector2D& parent) override {
+        return Vector2D{m_width.resolve(parent.x).value_or(m_extent.x), m_height.resolve(parent.y).value_or(m_extent.y)};
+    }
+
+    std::optional<Vector2D> minimumSize(const Vector2D& parent) override {
+        return Vector2D{m_width.mode == SIZE_PX ? m_width.value : 0, m_height.mode == SIZE_PX ? m_height.value : 0};
+    }
+
+    void setSize(jint width, jint height) {
+        m_width  = SSizeSpec::decode(width);
+        m_height = SSizeSpec::decode(height);
+    }
+
+    void replace(size_t from, size_t to, std::vector<SCommand>&& commands) {
+        from = std::min(from, m_commands.size());
+        to   = std::clamp(to, from, m_commands.size());
+        m_commands.erase(m_commands.begin() + from, m_commands.begin() + to);
+        m_commands.insert(m_commands.begin() + from, std::make_move_iterator(commands.begin()),
+                          std::make_move_iterator(commands.end()));
+        update();
+    }
+
+    size_t commandCount() const {
+        return m_commands.size();
+    }
+
+    void setCacheAsBitmap(bool cache) {
+        if (cache == m_cacheBitmap) return;
+        m_cacheBitmap = cache;
+        m_evicted     = false;
+        if (!cache) {
+            dropBitmap();
+            detachImage();
+            bitmapFileRelease(this);
+        }
+        sync();
+    }
+
+    void evictBitmap() override {
+        m_evicted = true;
+        m_bitmap.reset();
+        detachImage();
+        bitmapFileRelease(this);
+        sync();
+    }
+
+  private:
+    SSizeSpec               m_width, m_height;
+    std::vector<SCommand>   m_commands;
+    std::vector<SDrawOp>    m_ops;
+    std::vector<SDrawOp>    m_live;  // m_live[i] is drawn by m_prims[i]
+    std::vector<SDrawOp>    m_baked; // drawn into the bitmap instead
+    std::vector<SPrimitive> m_prims;
+    std::vector<SPrimitive> m_spare[PRIM_COUNT];
+    Vector2D                m_extent;
+    Vector2D                m_lineSize;
+
+    CBox                    m_box;
+    bool                    m_placed = false;
+
+    bool                                               m_cacheBitmap = false, m_evicted = false;
+    bool                                               m_imageAttached = false;
+    std::unique_ptr<CBitmap>                           m_bitmap;
+    Hyprutils::Memory::CSharedPointer<CImageElement>   m_image;
+
+    Vector2D canvasSize() const {
+        if (m_placed) return {m_box.w, m_box.h};
+        return {m_width.mode == SIZE_PX ? m_width.value : m_extent.x, m_height.mode == SIZE_PX ? m_height.value : m_extent.y};
+    }
+
+    void update() {
+        m_ops = resolveCommands(m_commands);
+
+        Vector2D extent;
+        for (const auto& op : m_ops) {
+            if (op.kind == PRIM_LINE) {
+                for (const auto& p : op.points) extent = {std::max(extent.x, p.x), std::max(extent.y, p.y)};
+            } else {
+                extent = {std::max(extent.x, op.x + op.w), std::max(extent.y, op.y + op.h)};
+            }
+        }
+        if (extent != m_extent) {
+            m_extent = extent;
+            // An auto-sized canvas changes size with its content
+            if (m_width.mode == SIZE_AUTO || m_height.mode == SIZE_AUTO) {
+                layoutInvalidate(this);
+            }
+        }
+
+        // An evicted canvas gets another chance at the cache when it changes
+        m_evicted = false;
+        sync();
+    }
+
+    // Split the ops between the bitmap and the live primitives
+    void sync() {
+        const bool           baking = m_cacheBitmap && !m_evicted;
+        std::vector<SDrawOp> live, baked;
+        for (const auto& op : m_ops) {
+            (baking && op.kind != PRIM_TEXT ? baked : live).push_back(op);
+        }
+
+        syncPrimitives(std::move(live));
+        if (baked != m_baked) {
+            dropBitmap();
+            m_baked = std::move(baked);
+        }
+
+        if (m_placed) {
+            place();
+        }
+    }
+
+    void syncPrimitives(std::vector<SDrawOp>&& ops) {
+        // Primitives are painted in child order, so where the kinds stop
+        // matching the tail is re-added in command order
+        size_t keep = 0;
+        while (keep < ops.size() && keep < m_prims.size() && m_prims[keep].kind == ops[keep].kind) {
+            ++keep;
+        }
+        releasePrimitives(keep);
+
+        for (size_t i = 0; i < keep; ++i) {
+            if (!(ops[i] == m_live[i])) build(m_prims[i], ops[i]);
+        }
+        for (size_t i = keep; i < ops.size(); ++i) {
+            auto& spare = m_spare[ops[i].kind];
+            if (!spare.empty()) {
+                m_prims.push_back(std::move(spare.back()));
+                spare.pop_back();
+            } else {
+                m_prims.push_back(SPrimitive{ops[i].kind});
+            }
+            build(m_prims.back(), ops[i]);
+            IElement::addChild(m_prims.back().element());
+        }
+        m_live = std::move(ops);
+    }
+
+    void releasePrimitives(size_t keep) {
+        for (size_t i = keep; i < m_prims.size(); ++i) {
+            IElement::removeChild(m_prims[i].element());
+            m_spare[m_prims[i].kind].push_back(std::move(m_prims[i]));
+        }
+        m_prims.resize(keep);
+        m_live.resize(std::min(keep, m_live.size()));
+    }
+
+    void build(SPrimitive& prim, const SDrawOp& op) {
+        switch (op.kind) {
+            case PRIM_RECT: {
+                auto builder = prim.rect ? prim.rect->rebuild() : CRectangleBuilder::begin();
+                builder->color([c = op.color]() { return unpackColor(c); })
+                    ->borderColor([c = op.borderColor]() { return unpackColor(c); })
+                    ->borderThickness(op.border)
+                    ->rounding(op.rounding)
+                    ->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE, CDynamicSize::HT_SIZE_ABSOLUTE, Vector2D{op.w, op.h}));
+                auto rect = builder->commence();
+                if (!prim.rect) prim.rect = rect;
+                break;
+            }
+            case PRIM_LINE: {
+                const Vector2D size = canvasSize();
+                const double   sw = std::max(1.0, size.x), sh = std::max(1.0, size.y);
+
+                std::vector<Vector2D> points;
+                points.reserve(op.points.size());
+                for (const auto& p : op.points) points.push_back({p.x / sw, p.y / sh});
+
+                auto builder = prim.line ? prim.line->rebuild() : CLineBuilder::begin();
+                builder->color([c = op.color]() { return unpackColor(c); })
+                    ->thick(op.thickness)
+                    ->points(std::move(points))
+                    ->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE, CDynamicSize::HT_SIZE_ABSOLUTE, Vector2D{sw, sh}));
+                auto line = builder->commence();
+                if (!prim.line) prim.line = line;
+                m_lineSize = size;
+                break;
+            }
+            case PRIM_TEXT: {
+                auto builder = prim.text ? prim.text->rebuild() : CTextBuilder::begin();
+                builder->text(std::string(op.text))
+                    ->fontSize(CFontSize(CFontSize::HT_FONT_ABSOLUTE, op.fontSize))
+                    ->color([c = op.color]() { return unpackColor(c); });
+                auto text = builder->commence();
+                if (!prim.text) prim.text = text;
+                break;
+            }
+            default: break;
+        }
+    }
+
+    void rebuildLines() {
+        for (size_t i = 0; i < m_prims.size(); ++i) {
+            if (m_prims[i].kind == PRIM_LINE) build(m_prims[i], m_live[i]);
+        }
+        m_lineSize = canvasSize();
+    }
+
+    void place() {
+        if (m_cacheBitmap && !m_evicted && !placeBitmap()) {
+            // Too big for the budget or no file: draw live
+            evictBitmap();
+            return;
+        }
+
+        for (size_t i = 0; i < m_prims.size(); ++i) {
+            const auto& op = m_live[i];
+            switch (op.kind) {
+                case PRIM_RECT:
+                    m_prims[i].rect->reposition({m_box.x + op.x, m_box.y + op.y, op.w, op.h}, {op.w, op.h});
+                    break;
+                case PRIM_LINE: m_prims[i].line->reposition(m_box, {m_box.w, m_box.h}); break;
+                case PRIM_TEXT: {
+                    const Vector2D room = {std::max(0.0, m_box.w - op.x), std::max(0.0, m_box.h - op.y)};
+                    const Vector2D size = m_prims[i].text->preferredSize(room).value_or(room);
+                    m_prims[i].text->reposition({m_box.x + op.x, m_box.y + op.y, size.x, size.y}, size);
+                    break;
+                }
+                default: break;
+            }
+        }
+    }
+
+    // Show the bitmap, rasterizing it first when the baked ops, the canvas
+    // size or the window scale changed since the last time
+    bool placeBitmap() {
+        const Vector2D size  = canvasSize();
+        const double   scale = bitmapScale();
+        const int      w = std::max(1, (int)std::ceil(size.x * scale)), h = std::max(1, (int)std::ceil(size.y * scale));
+
+        if (m_bitmap && m_bitmap->width() == w && m_bitmap->height() == h) {
+            if (!bitmapCacheUse(this, m_bitmap->bytes())) return false;
+            bitmapCacheNoteHit();
+        } else if (!raster(w, h, scale, size)) {
+            return false;
+        }
+
+        m_image->reposition(m_box, size);
+        return true;
+    }
+
+    // Rasterize at w x h pixels and show it at the canvas size; the file is
+    // this canvas's own, overwritten in place
+    bool raster(int w, int h, double scale, const Vector2D& size) {
+        dropBitmap();
+        if (!bitmapCacheUse(this, (size_t)w * h * sizeof(uint32_t))) return false;
+
+        auto bitmap = std::make_unique<CBitmap>(w, h, scale);
+        for (const auto& op : m_baked) {
+            if (op.kind == PRIM_RECT) bitmap->fillRect(op.x, op.y, op.w, op.h, op.color, op.rounding, op.borderColor, op.border);
+            else if (op.kind == PRIM_LINE) bitmap->polyline(op.points, op.color, op.thickness);
+        }
+
+        const auto& file = bitmapFileFor(this);
+        if (!bitmap->writePng(file)) {
+            bitmapCacheForget(this);
+            return false;
+        }
+
+        // Rebuilding reloads the image even though the path is unchanged
+        auto builder = m_image ? m_image->rebuild() : CImageBuilder::begin();
+        builder->path(std::string(file))
+            ->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE, CDynamicSize::HT_SIZE_ABSOLUTE, size));
+        auto image = builder->commence();
+        if (!m_image) m_image = image;
+
+        m_bitmap = std::move(bitmap);
+        bitmapCacheNoteRaster();
+        attachImage();
+        return true;
+    }
+
+    void dropBitmap() {
+        m_bitmap.reset();
+        bitmapCacheForget(this);
+    }
+
+    // The image has to be the first child so live text paints above it, so
+    // the primitives are re-added behind it (only when the mode changes)
+    void attachImage() {
+        if (m_imageAttached) return;
+
+        auto live = std::move(m_live);
+        releasePrimitives(0);
+        IElement::addChild(m_image);
+        m_imageAttached = true;
+        syncPrimitives(std::move(live));
+    }
+
+    void detachImage() {
+        if (!m_imageAttached) return;
+        IElement::removeChild(m_image);
+        m_imageAttached = false;
+    }
+};
+
+CCanvasElement* canvasFor(jlong handle) {
+    auto canvas = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CCanvasElement>*>(handle);
+    return canvas.get();
+}
+
+std::vector<SCommand> commandsFrom(JNIEnv* env, jobject buffer, jint length) {
+    auto* data = static_cast<const uint8_t*>(buffer ? env->GetDirectBufferAddress(buffer) : nullptr);
+    if (!data || length <= 0) return {};
+
+    const jlong capacity = env->GetDirectBufferCapacity(buffer);
+    return parseCommands(data, (size_t)std::min<jlong>(length, capacity));
+}
+
+} // namespace
+
+bool canvasSetSize(IElement* element, jint width, jint height) {
+    auto* canvas = dynamic_cast<CCanvasElement*>(element);
+    if (!canvas) return false;
+
+    canvas->setSize(width, height);
+    return true;
+}
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL
+Java_org_hyprclj_bindings_Canvas_00024Builder_nativeCreate(JNIEnv* env, jclass clazz, jint width, jint height) {
+    try {
+        auto canvas = Hyprutils::Memory::makeShared<CCanvasElement>();
+        canvas->setSize(width, height);
+        sizeNoteFill(canvas, width, height);
+        return reinterpret_cast<jlong>(new auto(canvas));
+    } catch (const std::exception& e) {
+        return 0;
+    }
+}
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Canvas_nativeReplaceCommands(
+    JNIEnv* env, jobject obj, jlong handle, jint from, jint to, jobject buffer, jint length) {
+
+    auto* canvas = canvasFor(handle);
+    if (!canvas) return 0;
+
+    // A negative end means "to the end of the list"
+    const size_t end = to < 0 ? canvas->commandCount() : (size_t)to;
+    canvas->replace((size_t)std::max(from, 0), end, commandsFrom(env, buffer, length));
+    return (jint)canvas->commandCount();
+}
+
+// Only canvases can be cached so far: their content is the one thing here
+// that can be rasterized without reading hyprtoolkit's renderer back
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetCacheAsBitmap(JNIEnv* env, jobject obj, jlong handle, jboolean cache) {
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    auto* canvas = dynamic_cast<CCanvasElement*>(element.get());
+    if (!canvas) return JNI_FALSE;
+
+    canvas->setCacheAsBitmap(cache);
+    return JNI_TRUE;
+}
+
+} // extern "C"
@@ -9,6 +9,12 @@ using Hyprutils::Math::Vector2D;
 extern JavaVM* g_jvm;
 extern JNIEnv* getEnv();
 
+namespace {
+
+jmethodID g_onToggleMethod = nullptr; // Checkbox$ToggleHandler.onToggle(Z)V
+
+} // namespace
+
 extern "C" {
 
 JNIEXPORT jlong JNICALL
@@ -16,30 +22,25 @@ Java_org_hyprclj_bindings_Checkbox_00024Builder_nativeCreate(
     JNIEnv* env, jclass clazz, jstring label, jboolean checked, jobject callback) {
 
     try {
-        const char* labelChars = env->GetStringUTFChars(label, nullptr);
-        std::string labelStr(labelChars);
-        env->ReleaseStringUTFChars(label, labelChars);
-
         auto builder = CCheckboxBuilder::begin();
         builder->toggled(checked);
 
-        // Wire up onToggled callback if provided
+        // Wire up onToggled callback if provided. The state is passed as a
+        // primitive boolean - no boxing per toggle.
         if (callback != nullptr) {
+            if (!g_onToggleMethod) {
+                jclass handlerClass = env->FindClass("org/hyprclj/bindings/Checkbox$ToggleHandler");
+                g_onToggleMethod    = env->GetMethodID(handlerClass, "onToggle", "(Z)V");
+            }
             jobject globalCallback = env->NewGlobalRef(callback);
 
             builder->onToggled([globalCallback](Hyprutils::Memory::CSharedPointer<CCheckboxElement> self, bool toggled) {
                 JNIEnv* env = getEnv();
-
-                // Call Java Consumer with the new state
-                jclass consumerClass = env->FindClass("java/util/function/Consumer");
-                jmethodID acceptMethod = env->GetMethodID(consumerClass, "accept", "(Ljava/lang/Object;)V");
-
-                // Box the boolean
-                jclass boolClass = env->FindClass("java/lang/Boolean");
-                jmethodID valueOfMethod = env->GetStaticMethodID(boolClass, "valueOf", "(Z)Ljava/lang/Boolean;");
-                jobject boxedBool = env->CallStaticObjectMethod(boolClass, valueOfMethod, (jboolean)toggled);
-
-                env->CallVoidMethod(globalCallback, acceptMethod, boxedBool);
+                env->CallVoidMethod(globalCallback, g_onToggleMethod, (jboolean)toggled);
+                if (env->ExceptionCheck()) {
+                    env->ExceptionDescribe();
+                    env->ExceptionClear();
+                }
             });
         }
 
@@ -6,6 +6,13 @@
 #include <hyprtoolkit/element/RowLayout.hpp>
 #include <hyprutils/math/Vector2D.hpp>
 #include <hyprutils/math/Box.hpp>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "hyprclj_layout.hpp"
+#include "hyprclj_mouse.hpp"
+#include "hyprclj_strings.hpp"
 
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
@@ -13,6 +20,37 @@ using Hyprutils::Math::Vector2D;
 extern JavaVM* g_jvm;
 extern JNIEnv* getEnv();
 
+namespace {
+
+// Position flag per interned align name (Strings.intern), resolved on first
+// use; -1 = not resolved yet, 0 = not an align name
+std::vector<int> g_alignFlags;
+
+int alignFlag(jint id) {
+    if (id < 0) return 0;
+    if ((size_t)id >= g_alignFlags.size()) {
+        g_alignFlags.resize(id + 1, -1);
+    }
+
+    int& flag = g_alignFlags[id];
+    if (flag < 0) {
+        static const std::pair<std::string_view, IElement::ePositionFlag> names[] = {
+            {"center", IElement::HT_POSITION_FLAG_CENTER}, {"hcenter", IElement::HT_POSITION_FLAG_HCENTER},
+            {"vcenter", IElement::HT_POSITION_FLAG_VCENTER}, {"left", IElement::HT_POSITION_FLAG_LEFT},
+            {"right", IElement::HT_POSITION_FLAG_RIGHT},   {"top", IElement::HT_POSITION_FLAG_TOP},
+            {"bottom", IElement::HT_POSITION_FLAG_BOTTOM},
+        };
+
+        flag = 0;
+        for (const auto& [name, value] : names) {
+            if (internedString(id) == name) flag = value;
+        }
+    }
+    return flag;
+}
+
+} // namespace
+
 extern "C" {
 
 // Element base class
@@ -25,6 +63,8 @@ Java_org_hyprclj_bindings_Element_nativeAddChild(
 
     if (element && child) {
         element->addChild(child);
+        layoutChildAdded(element, child);
+        mouseChildAdded(element, child);
     }
 }
 
@@ -37,6 +77,8 @@ Java_org_hyprclj_bindings_Element_nativeRemoveChild(
 
     if (element && child) {
         element->removeChild(child);
+        layoutChildRemoved(element.get(), child.get());
+        mouseChildRemoved(element.get(), child.get());
     }
 }
 
@@ -47,6 +89,7 @@ Java_org_hyprclj_bindings_Element_nativeClearChildren(
     auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
     if (element) {
         element->clearChildren();
+        layoutChildrenCleared(element.get());
     }
 }
 
@@ -60,6 +103,7 @@ Java_org_hyprclj_bindings_Element_nativeSetMargin(
         // setMargin only takes a single float in hyprtoolkit
         // Use the average or just top for simplicity
         element->setMargin((float)top);
+        layoutInvalidate(element.get());
     }
 }
 
@@ -70,81 +114,10 @@ Java_org_hyprclj_bindings_Element_nativeSetGrow(
     auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
     if (element) {
         element->setGrow(grow);
+        layoutInvalidate(element.get());
     }
 }
 
-JNIEXPORT void JNICALL
-Java_org_hyprclj_bindings_Element_nativeSetMouseClick(
-    JNIEnv* env, jobject obj, jlong handle, jobject callback) {
-
-    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
-    if (!element) return;
-
-    element->setReceivesMouse(true);
-    jobject globalCallback = env->NewGlobalRef(callback);
-
-    element->setMouseButton([globalCallback](Input::eMouseButton button, bool pressed) {
-        if (!pressed) return;  // Only fire on press
-
-        JNIEnv* env = getEnv();
-        jclass consumerClass = env->FindClass("java/util/function/Consumer");
-        jmethodID acceptMethod = env->GetMethodID(consumerClass, "accept", "(Ljava/lang/Object;)V");
-
-        // Create MouseEvent object
-        jclass mouseEventClass = env->FindClass("org/hyprclj/bindings/Element$MouseEvent");
-        jmethodID constructor = env->GetMethodID(mouseEventClass, "<init>", "(DDI)V");
-        jobject mouseEvent = env->NewObject(mouseEventClass, constructor, 0.0, 0.0, (jint)button);
-
-        env->CallVoidMethod(globalCallback, acceptMethod, mouseEvent);
-    });
-}
-
-JNIEXPORT void JNICALL
-Java_org_hyprclj_bindings_Element_nativeSetMouseEnter(
-    JNIEnv* env, jobject obj, jlong handle, jobject callback) {
-
-    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
-    if (!element) return;
-
-    element->setReceivesMouse(true);
-    jobject globalCallback = env->NewGlobalRef(callback);
-
-    element->setMouseEnter([globalCallback](const Vector2D& pos) {
-        JNIEnv* env = getEnv();
-        jclass consumerClass = env->FindClass("java/util/function/Consumer");
-        jmethodID acceptMethod = env->GetMethodID(consumerClass, "accept", "(Ljava/lang/Object;)V");
-
-        jclass mouseEventClass = env->FindClass("org/hyprclj/bindings/Element$MouseEvent");
-        jmethodID constructor = env->GetMethodID(mouseEventClass, "<init>", "(DDI)V");
-        jobject mouseEvent = env->NewObject(mouseEventClass, constructor, pos.x, pos.y, 0);
-
-        env->CallVoidMethod(globalCallback, acceptMethod, mouseEvent);
-    });
-}
-
-JNIEXPORT void JNICALL
-Java_org_hyprclj_bindings_Element_nativeSetMouseLeave(
-    JNIEnv* env, jobject obj, jlong handle, jobject callback) {
-
-    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
-    if (!element) return;
-
-    element->setReceivesMouse(true);
-    jobject globalCallback = env->NewGlobalRef(callback);
-
-    element->setMouseLeave([globalCallback]() {
-        JNIEnv* env = getEnv();
-        jclass consumerClass = env->FindClass("java/util/function/Consumer");
-        jmethodID acceptMethod = env->GetMethodID(consumerClass, "accept", "(Ljava/lang/Object;)V");
-
-        jclass mouseEventClass = env->FindClass("org/hyprclj/bindings/Element$MouseEvent");
-        jmethodID constructor = env->GetMethodID(mouseEventClass, "<init>", "(DDI)V");
-        jobject mouseEvent = env->NewObject(mouseEventClass, constructor, 0.0, 0.0, 0);
-
-        env->CallVoidMethod(globalCallback, acceptMethod, mouseEvent);
-    });
-}
-
 JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Element_nativeSetGrowBoth(
     JNIEnv* env, jobject obj, jlong handle, jboolean growH, jboolean growV) {
@@ -152,6 +125,7 @@ Java_org_hyprclj_bindings_Element_nativeSetGrowBoth(
     auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
     if (element) {
         element->setGrow(growH, growV);
+        layoutInvalidate(element.get());
     }
 }
 
@@ -162,40 +136,30 @@ Java_org_hyprclj_bindings_Element_nativeSetSize(
     auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
     if (!element) return;
 
-    // Use reposition to set the element's size
-    // Create a box at origin with the specified size
-    Hyprutils::Math::CBox box{0, 0, (double)width, (double)height};
-    Vector2D maxSize{(double)width, (double)height};
+    // Rebuild with the new size specs, so the parent keeps resolving them
+    // (percentages included) on every relayout
+    if (sizeApply(element, width, height)) return;
+
+    // Unknown element type: place it once at the requested pixel size
+    const auto w = SSizeSpec::decode(width), h = SSizeSpec::decode(height);
+    if (w.mode != SIZE_PX || h.mode != SIZE_PX) return;
+
+    Hyprutils::Math::CBox box{0, 0, w.value, h.value};
+    Vector2D maxSize{w.value, h.value};
 
     element->reposition(box, maxSize);
 }
 
 JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Element_nativeSetAlign(
-    JNIEnv* env, jobject obj, jlong handle, jstring align) {
+    JNIEnv* env, jobject obj, jlong handle, jint alignId) {
 
     auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
     if (!element) return;
 
-    const char* alignChars = env->GetStringUTFChars(align, nullptr);
-    std::string alignStr(alignChars);
-    env->ReleaseStringUTFChars(align, alignChars);
-
-    // Map string to position flags
-    if (alignStr == "center") {
-        element->setPositionFlag(IElement::HT_POSITION_FLAG_CENTER, true);
-    } else if (alignStr == "hcenter") {
-        element->setPositionFlag(IElement::HT_POSITION_FLAG_HCENTER, true);
-    } else if (alignStr == "vcenter") {
-        element->setPositionFlag(IElement::HT_POSITION_FLAG_VCENTER, true);
-    } else if (alignStr == "left") {
-        element->setPositionFlag(IElement::HT_POSITION_FLAG_LEFT, true);
-    } else if (alignStr == "right") {
-        element->setPositionFlag(IElement::HT_POSITION_FLAG_RIGHT, true);
-    } else if (alignStr == "top") {
-        element->setPositionFlag(IElement::HT_POSITION_FLAG_TOP, true);
-    } else if (alignStr == "bottom") {
-        element->setPositionFlag(IElement::HT_POSITION_FLAG_BOTTOM, true);
+    // Align names cross interned; the flag is looked up once per name
+    if (const int flag = alignFlag(alignId)) {
+        element->setPositionFlag(static_cast<IElement::ePositionFlag>(flag), true);
     }
 }
 
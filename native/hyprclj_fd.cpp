@@ -0,0 +1,145 @@
+#include <jni.h>
+#include <hyprtoolkit/core/Backend.hpp>
+#include <poll.h>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace Hyprtoolkit;
+
+extern JavaVM* g_jvm;
+extern JNIEnv* getEnv();
+
+// File descriptor watches
+//
+// External fds (pipes, sockets, inotify, timerfds...) are registered with
+// the backend loop, so their readiness is dispatched on the UI thread as it
+// happens instead of being polled from a timer. The loop wakes us when an fd
+// is readable; the exact readiness is read back with a zero-timeout poll()
+// and passed to the Java handler as Backend.FD_* bits.
+//
+// The loop only waits for readability (level-triggered), so every watch
+// includes FD_READABLE; one without it would wake the loop for data nobody
+// reads, forever.
+//
+// A hangup or error keeps an fd ready forever, so after delivering one the
+// watch is removed. Handlers should read until EAGAIN/EOF when they see
+// FD_HANGUP.
+//
+// Removing a watch drops it at once, but the fd leaves the backend loop
+// from an idle callback: removal is often requested from inside the loop's
+// own fd callback. An fd watched again before then keeps its registration.
+namespace {
+
+// Keep in sync with Backend.FD_*
+enum eFdEvent : int {
+    FD_READABLE = 1 << 0,
+    FD_HANGUP   = 1 << 1,
+    FD_ERROR    = 1 << 2,
+};
+
+struct SFdWatch {
+    jobject handler = nullptr; // Backend$FdHandler
+    int     events  = 0;
+};
+
+Hyprutils::Memory::CSharedPointer<IBackend> g_backend;
+std::unordered_map<int, SFdWatch>           g_watches;
+std::unordered_set<int>                     g_removing; // still registered with the loop
+jmethodID                                   g_onReady = nullptr;
+
+int readiness(int fd) {
+    pollfd pfd = {.fd = fd, .events = POLLIN, .revents = 0};
+    if (poll(&pfd, 1, 0) <= 0) return 0;
+
+    int events = 0;
+    if (pfd.revents & POLLIN) events |= FD_READABLE;
+    if (pfd.revents & POLLHUP) events |= FD_HANGUP;
+    if (pfd.revents & (POLLERR | POLLNVAL)) events |= FD_ERROR;
+    return events;
+}
+
+void removePending() {
+    for (int fd : g_removing) {
+        g_backend->removeFd(fd);
+    }
+    g_removing.clear();
+}
+
+void unwatch(int fd) {
+    auto it = g_watches.find(fd);
+    if (it == g_watches.end()) return;
+
+    getEnv()->DeleteGlobalRef(it->second.handler);
+    g_watches.erase(it);
+
+    if (g_backend) {
+        if (g_removing.empty()) {
+            g_backend->addIdle([]() { removePending(); });
+        }
+        g_removing.insert(fd);
+    }
+}
+
+void onFdReady(int fd) {
+    auto it = g_watches.find(fd);
+    if (it == g_watches.end()) return;
+
+    const int ready = readiness(fd);
+    // Hangups and errors are always reported, like poll()
+    const int events = ready & (it->second.events | FD_HANGUP | FD_ERROR);
+    if (!events) return;
+
+    // The handler may remove (and re-add) its own watch
+    JNIEnv* env     = getEnv();
+    jobject handler = env->NewLocalRef(it->second.handler);
+    env->CallVoidMethod(handler, g_onReady, (jint)fd, (jint)events);
+    if (env->ExceptionCheck()) {
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+
+    if (events & (FD_HANGUP | FD_ERROR)) {
+        auto again = g_watches.find(fd);
+        if (again != g_watches.end() && env->IsSameObject(again->second.handler, handler)) {
+            unwatch(fd);
+        }
+    }
+    env->DeleteLocalRef(handler);
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Backend_nativeAddFd(
+    JNIEnv* env, jobject obj, jlong handle, jint fd, jint events, jobject handler) {
+
+    auto backend = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(handle);
+    if (!backend || !handler || fd < 0 || g_watches.contains(fd)) return false;
+    if (events && !(events & FD_READABLE)) return false;
+
+    if (!g_backend) {
+        g_backend = backend;
+    }
+    if (!g_onReady) {
+        jclass handlerClass = env->FindClass("org/hyprclj/bindings/Backend$FdHandler");
+        g_onReady           = env->GetMethodID(handlerClass, "onReady", "(II)V");
+    }
+
+    g_watches[fd] = {env->NewGlobalRef(handler), events ? (int)events : FD_READABLE};
+    // Still registered from a watch removed this iteration: keep that one
+    if (!g_removing.erase(fd)) {
+        backend->addFd(fd, [fd]() { onFdReady(fd); });
+    }
+    return true;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Backend_nativeRemoveFd(JNIEnv* env, jobject obj, jlong handle, jint fd) {
+    if (!g_watches.contains(fd)) return false;
+    unwatch(fd);
+    return true;
+}
+
+} // extern "C"
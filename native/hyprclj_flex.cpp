@@ -0,0 +1,329 @@
+#include <jni.h>
+#include <hyprtoolkit/core/CoreMacros.hpp>  // Must be included first for HT_HIDDEN
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <hyprutils/math/Box.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "hyprclj_layout.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::CBox;
+using Hyprutils::Math::Vector2D;
+
+// Flex container
+//
+// A container that lays out its children along one axis like CSS flexbox:
+// children get their preferred (or basis) size, free space is handed out by
+// grow factors and overflow taken back by shrink factors, then distributed
+// by justify; on the cross axis children are aligned or stretched.
+//
+// Layout is incremental: a container keeps the boxes it computed and only
+// re-runs distribution when its box, its properties, its children or their
+// measured sizes changed. Property changes relayout in place on the next
+// frame (one pass however many changed), starting from the outermost
+// container they affect, without a Clojure re-render.
+namespace {
+
+// Keep in sync with Flex.JUSTIFY_*
+enum eJustify : int {
+    JUSTIFY_START = 0,
+    JUSTIFY_CENTER,
+    JUSTIFY_END,
+    JUSTIFY_BETWEEN,
+    JUSTIFY_AROUND,
+    JUSTIFY_EVENLY,
+};
+
+class CFlexElement : public CLayoutContainer {
+  public:
+    bool  m_column  = true;
+    int   m_justify = JUSTIFY_START;
+    int   m_align   = ALIGN_START;
+    float m_gap     = 0;
+
+  protected:
+    Vector2D contentSize(const Vector2D& inner) override {
+        double main = 0, cross = 0;
+        for (auto& child : m_children) {
+            const auto  pref = layoutConstrain(child.get(), layoutPreferred(child.get(), inner).value_or(Vector2D{0, 0}));
+            const auto& item = layoutItemOf(child.get());
+            main += item.basis >= 0 ? item.basis : mainOf(pref);
+            cross = std::max(cross, crossOf(pref));
+        }
+        return fromAxes(main + gapTotal(), cross);
+    }
+
+    Vector2D contentMinimum(const Vector2D& inner) override {
+        double main = 0, cross = 0;
+        for (auto& child : m_children) {
+            const auto  min  = layoutConstrain(child.get(), layoutMinimum(child.get(), inner).value_or(Vector2D{0, 0}));
+            const auto& item = layoutItemOf(child.get());
+            // A child that can't shrink keeps its basis
+            main += item.shrink > 0 ? mainOf(min) : std::max(mainOf(min), (double)item.basis);
+            cross = std::max(cross, crossOf(min));
+        }
+        return fromAxes(main + gapTotal(), cross);
+    }
+
+    void layoutChildren(const CBox& inner, bool dirty) override {
+        const size_t   n     = m_children.size();
+        const Vector2D space = {inner.w, inner.h};
+
+        std::vector<Vector2D> measured(n);
+        for (size_t i = 0; i < n; ++i) {
+            measured[i] = layoutConstrain(m_children[i].get(), layoutPreferred(m_children[i].get(), space).value_or(Vector2D{0, 0}));
+        }
+
+        // Nothing that feeds the distribution changed: reuse the boxes
+        if (dirty || measured != m_measured || m_childBoxes.size() != n) {
+            distribute(inner, measured);
+            m_measured = std::move(measured);
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            placeChild(i, m_childBoxes[i]);
+        }
+    }
+
+  private:
+    // Cache of the last distribution
+    std::vector<Vector2D> m_measured;
+    std::vector<CBox>     m_childBoxes;
+
+    double mainOf(const Vector2D& v) const {
+        return m_column ? v.y : v.x;
+    }
+
+    double crossOf(const Vector2D& v) const {
+        return m_column ? v.x : v.y;
+    }
+
+    Vector2D fromAxes(double main, double cross) const {
+        return m_column ? Vector2D{cross, main} : Vector2D{main, cross};
+    }
+
+    double gapTotal() const {
+        return m_children.size() > 1 ? m_gap * (m_children.size() - 1) : 0;
+    }
+
+    bool fillsMain(const SLayoutItem& item) const {
+        return m_column ? item.fillY : item.fillX;
+    }
+
+    bool fillsCross(const SLayoutItem& item) const {
+        return m_column ? item.fillX : item.fillY;
+    }
+
+    void distribute(const CBox& inner, const std::vector<Vector2D>& measured) {
+        const size_t     n         = m_children.size();
+        const Vector2D   space     = {inner.w, inner.h};
+        const double     innerMain = mainOf(space), innerCross = crossOf(space);
+        constexpr double INF       = std::numeric_limits<double>::infinity();
+
+        // FILL children grow into the free space from a zero basis
+        std::vector<double> base(n), size(n), grow(n), minMain(n), maxMain(n);
+        for (size_t i = 0; i < n; ++i) {
+            IElement*   child = m_children[i].get();
+            const auto& item  = layoutItemOf(child);
+
+            minMain[i]     = mainOf(layoutConstrain(child, layoutMinimum(child, space).value_or(Vector2D{0, 0})));
+            const auto max = child->maximumSize(space);
+            maxMain[i]     = max && mainOf(*max) > 0 ? mainOf(*max) : INF;
+            const double constrainedMax = mainOf(item.maxSize);
+            if (constrainedMax >= 0) maxMain[i] = std::min(maxMain[i], constrainedMax);
+
+            grow[i] = fillsMain(item) ? std::max(item.grow, 1.0f) : item.grow;
+            base[i] = item.basis >= 0 ? item.basis : fillsMain(item) ? 0 : mainOf(measured[i]);
+            size[i] = std::clamp(base[i], minMain[i], std::max(minMain[i], maxMain[i]));
+        }
+
+        // Hand out free space (or take back overflow) by grow / shrink
+        // factors; children that hit a limit are frozen and the rest is
+        // redistributed among the others
+        std::vector<bool> frozen(n, false);
+        for (size_t pass = 0; pass < n; ++pass) {
+            double used = gapTotal();
+            for (double s : size) used += s;
+            const double free    = innerMain - used;
+            const bool   growing = free > 0;
+            if (std::abs(free) < 0.5) break;
+
+            double weight = 0;
+            for (size_t i = 0; i < n; ++i) {
+                if (frozen[i]) continue;
+                weight += growing ? grow[i] : layoutItemOf(m_children[i].get()).shrink * base[i];
+            }
+            if (weight <= 0) break;
+
+            bool clamped = false;
+            for (size_t i = 0; i < n; ++i) {
+                if (frozen[i]) continue;
+                const double w = growing ? grow[i] : layoutItemOf(m_children[i].get()).shrink * base[i];
+                if (w <= 0) continue;
+
+                double target = size[i] + free * w / weight;
+                if (growing && target > maxMain[i]) {
+                    target    = maxMain[i];
+                    frozen[i] = clamped = true;
+                } else if (!growing && target < minMain[i]) {
+                    target    = minMain[i];
+                    frozen[i] = clamped = true;
+                }
+                size[i] = target;
+            }
+            if (!clamped) break;
+        }
+
+        // Justify what is left
+        double used = gapTotal();
+        for (double s : size) used += s;
+        const double free = std::max(0.0, innerMain - used);
+
+        double lead = 0, spacing = m_gap;
+        switch (m_justify) {
+            case JUSTIFY_CENTER: lead = free / 2; break;
+            case JUSTIFY_END: lead = free; break;
+            case JUSTIFY_BETWEEN:
+                if (n > 1) spacing += free / (n - 1);
+                break;
+            case JUSTIFY_AROUND:
+                if (n > 0) {
+                    lead = free / (2 * n);
+                    spacing += free / n;
+                }
+                break;
+            case JUSTIFY_EVENLY:
+                lead = free / (n + 1);
+                spacing += free / (n + 1);
+                break;
+            default: break;
+        }
+
+        const double originMain  = m_column ? inner.y : inner.x;
+        const double originCross = m_column ? inner.x : inner.y;
+
+        m_childBoxes.resize(n);
+        double pos = originMain + lead;
+        for (size_t i = 0; i < n; ++i) {
+            IElement*   child = m_children[i].get();
+            const auto& item  = layoutItemOf(child);
+            const int   align = fillsCross(item)              ? ALIGN_STRETCH :
+                                item.alignSelf == ALIGN_AUTO ? m_align :
+                                                               item.alignSelf;
+
+            double cross = align == ALIGN_STRETCH ? innerCross : std::min(crossOf(measured[i]), innerCross);
+            cross        = crossOf(layoutConstrain(child, fromAxes(0, cross)));
+
+            double offset = 0;
+            if (align == ALIGN_CENTER) {
+                offset = (innerCross - cross) / 2;
+            } else if (align == ALIGN_END) {
+                offset = innerCross - cross;
+            }
+
+            // Snap to whole pixels so neighbours don't blur or overlap
+            const double mainStart = std::round(pos), mainEnd = std::round(pos + size[i]);
+            const double crossStart = std::round(originCross + offset);
+            const double crossSize  = std::round(cross);
+
+            m_childBoxes[i] = m_column ? CBox{crossStart, mainStart, crossSize, mainEnd - mainStart} :
+                                         CBox{mainStart, crossStart, mainEnd - mainStart, crossSize};
+            pos += size[i] + spacing;
+        }
+    }
+};
+
+CFlexElement* flexFor(jlong handle) {
+    auto flex = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CFlexElement>*>(handle);
+    return flex.get();
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL
+Java_org_hyprclj_bindings_Flex_00024Builder_nativeCreate(
+    JNIEnv* env, jclass clazz, jboolean column, jint justify, jint align, jint gap, jint padding,
+    jint width, jint height, jint background, jint borderColor, jint border, jint rounding) {
+
+    try {
+        auto flex = Hyprutils::Memory::makeShared<CFlexElement>();
+
+        flex->m_column  = column;
+        flex->m_justify = justify;
+        flex->m_align   = align;
+        flex->m_gap     = (float)std::max(gap, 0);
+        flex->setPadding((float)padding);
+        flex->setSize(width, height);
+        flex->setStyle((uint32_t)background, (uint32_t)borderColor, border, rounding);
+        sizeNoteFill(flex, width, height);
+
+        return reinterpret_cast<jlong>(new auto(flex));
+    } catch (const std::exception& e) {
+        return 0;
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Flex_nativeSetDirection(JNIEnv* env, jobject obj, jlong handle, jboolean column) {
+    if (auto* flex = flexFor(handle)) {
+        flex->m_column = column;
+        flex->invalidate();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Flex_nativeSetJustify(JNIEnv* env, jobject obj, jlong handle, jint justify) {
+    if (auto* flex = flexFor(handle)) {
+        flex->m_justify = justify;
+        flex->invalidate();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Flex_nativeSetAlignItems(JNIEnv* env, jobject obj, jlong handle, jint align) {
+    if (auto* flex = flexFor(handle)) {
+        flex->m_align = align;
+        flex->invalidate();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Flex_nativeSetGap(JNIEnv* env, jobject obj, jlong handle, jint gap, jint padding) {
+    if (auto* flex = flexFor(handle)) {
+        flex->m_gap = (float)std::max(gap, 0);
+        flex->setPadding((float)padding);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Flex_nativeSetStyle(
+    JNIEnv* env, jobject obj, jlong handle, jint background, jint borderColor, jint border, jint rounding) {
+
+    if (auto* flex = flexFor(handle)) {
+        flex->setStyle((uint32_t)background, (uint32_t)borderColor, border, rounding);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetFlexItem(
+    JNIEnv* env, jobject obj, jlong handle, jfloat grow, jfloat shrink, jfloat basis, jint alignSelf) {
+
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    if (!element) return;
+
+    auto& item     = layoutItemFor(element);
+    item.grow      = std::max(grow, 0.0f);
+    item.shrink    = std::max(shrink, 0.0f);
+    item.basis     = basis;
+    item.alignSelf = alignSelf;
+
+    layoutInvalidate(element.get());
+}
+
+} // extern "C"
@@ -0,0 +1,454 @@
+#include <jni.h>
+#include <hyprtoolkit/core/CoreMacros.hpp>  // Must be included first for HT_HIDDEN
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <hyprutils/math/Box.hpp>
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+#include "hyprclj_layout.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::CBox;
+using Hyprutils::Math::Vector2D;
+
+// Grid container
+//
+// Children are placed in the cells of a grid of row and column tracks. A
+// track is fixed (px), fractional (fr: a share of the space the other
+// tracks leave) or sized by its content (auto). A child may span several
+// tracks (Element.setGridCell); children without a cell flow into the next
+// free one, row by row, adding auto rows as needed.
+//
+// A table is one flat pass instead of a row layout per line inside a
+// column layout: children are measured once, track sizes are computed from
+// those measurements and cached, and are only recomputed when the grid's
+// box, its properties, its children or a child's measured size changed.
+namespace {
+
+// Keep in sync with Grid.px / fr / AUTO
+enum eTrackKind : int {
+    TRACK_PX = 0,
+    TRACK_FR, // value in hundredths
+    TRACK_AUTO,
+};
+
+struct STrack {
+    eTrackKind kind  = TRACK_AUTO;
+    double     value = 0; // px, or fr weight
+
+    static STrack decode(jint spec) {
+        if (spec < 0) return {};
+
+        const int value = spec & 0xFFFFFF;
+        switch (spec >> 24) {
+            case TRACK_PX: return {TRACK_PX, (double)value};
+            case TRACK_FR: return value > 0 ? STrack{TRACK_FR, value / 100.0} : STrack{};
+            default: return {};
+        }
+    }
+};
+
+struct SCell {
+    int row = 0, column = 0, rowSpan = 1, columnSpan = 1;
+};
+
+std::vector<STrack> decodeTracks(JNIEnv* env, jintArray specs) {
+    std::vector<STrack> tracks;
+    if (!specs) return tracks;
+
+    const jsize      count = env->GetArrayLength(specs);
+    std::vector<jint> raw(count);
+    env->GetIntArrayRegion(specs, 0, count, raw.data());
+
+    tracks.reserve(count);
+    for (jint spec : raw) {
+        tracks.push_back(STrack::decode(spec));
+    }
+    return tracks;
+}
+
+class CGridElement : public CLayoutContainer {
+  public:
+    std::vector<STrack> m_columns, m_rows; // explicit tracks; extra ones are auto
+    float               m_rowGap = 0, m_columnGap = 0;
+    int                 m_align = ALIGN_STRETCH;
+
+  protected:
+    Vector2D contentSize(const Vector2D& inner) override {
+        return measureContent(inner, false);
+    }
+
+    Vector2D contentMinimum(const Vector2D& inner) override {
+        return measureContent(inner, true);
+    }
+
+    void layoutChildren(const CBox& inner, bool dirty) override {
+        const size_t n        = m_children.size();
+        auto         measured = measure({inner.w, inner.h}, false);
+
+        // Nothing that feeds the track sizes changed: reuse the boxes
+        if (dirty || measured != m_measured || m_childBoxes.size() != n) {
+            place();
+            arrange(inner, measured);
+            m_measured = std::move(measured);
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            placeChild(i, m_childBoxes[i]);
+        }
+    }
+
+  private:
+    // Placement and the cache of the last arrangement
+    std::vector<SCell>    m_cells;
+    size_t                m_columnCount = 0, m_rowCount = 0;
+    std::vector<Vector2D> m_measured;
+    std::vector<double>   m_columnSizes, m_rowSizes;
+    std::vector<CBox>     m_childBoxes;
+
+    std::vector<Vector2D> measure(const Vector2D& space, bool minimum) {
+        std::vector<Vector2D> sizes(m_children.size());
+        for (size_t i = 0; i < m_children.size(); ++i) {
+            IElement*  child = m_children[i].get();
+            const auto size  = minimum ? layoutMinimum(child, space) : layoutPreferred(child, space);
+            sizes[i]         = layoutConstrain(child, size.value_or(Vector2D{0, 0}));
+        }
+        return sizes;
+    }
+
+    Vector2D measureContent(const Vector2D& inner, bool minimum) {
+        place();
+        const auto sizes   = measure(inner, minimum);
+        const auto columns = sizeTracks(tracks(m_columns, m_columnCount), sizes, true, std::nullopt, !minimum);
+        const auto rows    = sizeTracks(tracks(m_rows, m_rowCount), sizes, false, std::nullopt, !minimum);
+        return {total(columns, m_columnGap), total(rows, m_rowGap)};
+    }
+
+    static std::vector<STrack> tracks(const std::vector<STrack>& explicitTracks, size_t count) {
+        std::vector<STrack> out = explicitTracks;
+        out.resize(std::max(count, explicitTracks.size()));
+        return out;
+    }
+
+    static double total(const std::vector<double>& sizes, double gap) {
+        double sum = sizes.empty() ? 0 : gap * (sizes.size() - 1);
+        for (double s : sizes) sum += s;
+        return sum;
+    }
+
+    static double spanSize(const std::vector<double>& sizes, int start, int span, double gap) {
+        double sum = gap * (span - 1);
+        for (int t = start; t < start + span; ++t) sum += sizes[t];
+        return sum;
+    }
+
+    // Assign every child a cell: explicit cells first, then the rest flow
+    // row by row into the first free cells that fit
+    void place() {
+        const size_t n = m_children.size();
+        m_cells.assign(n, {});
+
+        m_columnCount = std::max<size_t>(m_columns.size(), 1);
+        for (auto& child : m_children) {
+            const auto& item = layoutItemOf(child.get());
+            if (item.gridColumn >= 0) {
+                m_columnCount = std::max<size_t>(m_columnCount, item.gridColumn + std::max(item.columnSpan, 1));
+            }
+        }
+
+        const int                      columns = (int)m_columnCount;
+        std::vector<std::vector<bool>> used;
+
+        auto fits = [&](int row, int column, int rowSpan, int columnSpan) {
+            if (column + columnSpan > columns) return false;
+            for (int r = row; r < row + rowSpan && r < (int)used.size(); ++r) {
+                for (int c = column; c < column + columnSpan; ++c) {
+                    if (used[r][c]) return false;
+                }
+            }
+            return true;
+        };
+
+        auto take = [&](size_t i, int row, int column, int rowSpan, int columnSpan) {
+            if ((int)used.size() < row + rowSpan) used.resize(row + rowSpan, std::vector<bool>(columns, false));
+            for (int r = row; r < row + rowSpan; ++r) {
+                for (int c = column; c < column + columnSpan; ++c) used[r][c] = true;
+            }
+            m_cells[i] = {row, column, rowSpan, columnSpan};
+        };
+
+        std::vector<size_t> flowing;
+        for (size_t i = 0; i < n; ++i) {
+            const auto& item = layoutItemOf(m_children[i].get());
+            const int   rs = std::max(item.rowSpan, 1), cs = std::clamp(item.columnSpan, 1, columns);
+            if (item.gridRow >= 0 && item.gridColumn >= 0) {
+                take(i, item.gridRow, item.gridColumn, rs, cs);
+            } else {
+                flowing.push_back(i);
+            }
+        }
+
+        int cursorRow = 0, cursorColumn = 0;
+        for (size_t i : flowing) {
+            const auto& item = layoutItemOf(m_children[i].get());
+            const int   rs = std::max(item.rowSpan, 1), cs = std::clamp(item.columnSpan, 1, columns);
+
+            if (item.gridColumn >= 0) {
+                // Fixed column: first row where it fits
+                int row = 0;
+                while (!fits(row, item.gridColumn, rs, cs)) ++row;
+                take(i, row, item.gridColumn, rs, cs);
+            } else if (item.gridRow >= 0) {
+                // Fixed row: first column where it fits, or the row's end
+                int column = 0;
+                while (column + cs <= columns && !fits(item.gridRow, column, rs, cs)) ++column;
+                take(i, item.gridRow, column + cs <= columns ? column : 0, rs, cs);
+            } else {
+                while (!fits(cursorRow, cursorColumn, rs, cs)) {
+                    if (++cursorColumn + cs > columns) {
+                        cursorColumn = 0;
+                        ++cursorRow;
+                    }
+                }
+                take(i, cursorRow, cursorColumn, rs, cs);
+                cursorColumn += cs;
+            }
+        }
+
+        m_rowCount = std::max(m_rows.size(), used.size());
+    }
+
+    // Track sizes along one axis. px tracks are fixed, auto tracks fit their
+    // content, fr tracks share what is left of the available space but
+    // never drop below their content. Without available space (measuring)
+    // fr tracks keep their ratios at the smallest size fitting all content.
+    std::vector<double> sizeTracks(const std::vector<STrack>& tracks, const std::vector<Vector2D>& sizes, bool columns,
+                                   std::optional<double> available, bool normalize) const {
+        const size_t        count = tracks.size();
+        const double        gap   = columns ? m_columnGap : m_rowGap;
+        std::vector<double> out(count, 0);
+
+        for (size_t t = 0; t < count; ++t) {
+            if (tracks[t].kind == TRACK_PX) out[t] = tracks[t].value;
+        }
+
+        // Children in one track first, then spanning children top up the
+        // flexible tracks they cross
+        for (size_t i = 0; i < m_cells.size(); ++i) {
+            const int start = columns ? m_cells[i].column : m_cells[i].row;
+            const int span  = columns ? m_cells[i].columnSpan : m_cells[i].rowSpan;
+            if (span == 1 && tracks[start].kind != TRACK_PX) {
+                out[start] = std::max(out[start], columns ? sizes[i].x : sizes[i].y);
+            }
+        }
+        for (size_t i = 0; i < m_cells.size(); ++i) {
+            const int start = columns ? m_cells[i].column : m_cells[i].row;
+            const int span  = columns ? m_cells[i].columnSpan : m_cells[i].rowSpan;
+            if (span == 1) continue;
+
+            const double deficit = (columns ? sizes[i].x : sizes[i].y) - spanSize(out, start, span, gap);
+            if (deficit <= 0) continue;
+
+            int flexible = 0;
+            for (int t = start; t < start + span; ++t) flexible += tracks[t].kind != TRACK_PX;
+            if (!flexible) continue;
+            for (int t = start; t < start + span; ++t) {
+                if (tracks[t].kind != TRACK_PX) out[t] += deficit / flexible;
+            }
+        }
+
+        double weight = 0;
+        for (const auto& track : tracks) {
+            if (track.kind == TRACK_FR) weight += track.value;
+        }
+        if (weight <= 0) return out;
+
+        if (!available) {
+            if (normalize) {
+                double unit = 0;
+                for (size_t t = 0; t < count; ++t) {
+                    if (tracks[t].kind == TRACK_FR) unit = std::max(unit, out[t] / tracks[t].value);
+                }
+                for (size_t t = 0; t < count; ++t) {
+                    if (tracks[t].kind == TRACK_FR) out[t] = unit * tracks[t].value;
+                }
+            }
+            return out;
+        }
+
+        // Tracks whose content outgrows their share keep their content size
+        // and the rest is shared again among the others
+        double            fixed = count > 1 ? gap * (count - 1) : 0;
+        std::vector<bool> frozen(count, false);
+        for (size_t t = 0; t < count; ++t) {
+            if (tracks[t].kind != TRACK_FR) fixed += out[t];
+        }
+        for (;;) {
+            double shares = 0;
+            for (size_t t = 0; t < count; ++t) {
+                if (tracks[t].kind == TRACK_FR && !frozen[t]) shares += tracks[t].value;
+            }
+            if (shares <= 0) break;
+
+            const double unit    = std::max(0.0, *available - fixed) / shares;
+            bool         changed = false;
+            for (size_t t = 0; t < count; ++t) {
+                if (tracks[t].kind != TRACK_FR || frozen[t] || out[t] <= unit * tracks[t].value) continue;
+                frozen[t] = changed = true;
+                fixed += out[t];
+            }
+            if (changed) continue;
+
+            for (size_t t = 0; t < count; ++t) {
+                if (tracks[t].kind == TRACK_FR && !frozen[t]) out[t] = unit * tracks[t].value;
+            }
+            break;
+        }
+        return out;
+    }
+
+    static std::vector<double> offsets(const std::vector<double>& sizes, double origin, double gap) {
+        std::vector<double> out(sizes.size());
+        double              pos = origin;
+        for (size_t t = 0; t < sizes.size(); ++t) {
+            out[t] = pos;
+            pos += sizes[t] + gap;
+        }
+        return out;
+    }
+
+    static void alignIn(int align, double cell, double want, double& offset, double& size) {
+        size   = align == ALIGN_STRETCH ? cell : std::min(want, cell);
+        offset = align == ALIGN_CENTER ? (cell - size) / 2 : align == ALIGN_END ? cell - size : 0;
+    }
+
+    void arrange(const CBox& inner, const std::vector<Vector2D>& measured) {
+        const size_t n = m_children.size();
+
+        m_columnSizes = sizeTracks(tracks(m_columns, m_columnCount), measured, true, inner.w, true);
+
+        // Heights depend on widths (wrapping text): measure again at the
+        // width each child actually gets, unless that is the full width it
+        // was just measured at
+        std::vector<Vector2D> atWidth(n);
+        for (size_t i = 0; i < n; ++i) {
+            IElement*    child = m_children[i].get();
+            const double width = spanSize(m_columnSizes, m_cells[i].column, m_cells[i].columnSpan, m_columnGap);
+            atWidth[i]         = width == inner.w ? measured[i] :
+                                                    layoutConstrain(child, layoutPreferred(child, {width, inner.h}).value_or(Vector2D{0, 0}));
+        }
+        m_rowSizes = sizeTracks(tracks(m_rows, m_rowCount), atWidth, false, inner.h, true);
+
+        const auto columnStarts = offsets(m_columnSizes, inner.x, m_columnGap);
+        const auto rowStarts    = offsets(m_rowSizes, inner.y, m_rowGap);
+
+        m_childBoxes.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            IElement*   child = m_children[i].get();
+            const auto& item  = layoutItemOf(child);
+            const auto& cell  = m_cells[i];
+            const int   align = item.alignSelf == ALIGN_AUTO ? m_align : item.alignSelf;
+
+            const double cellW = spanSize(m_columnSizes, cell.column, cell.columnSpan, m_columnGap);
+            const double cellH = spanSize(m_rowSizes, cell.row, cell.rowSpan, m_rowGap);
+
+            double x, y, w, h;
+            alignIn(item.fillX ? ALIGN_STRETCH : align, cellW, atWidth[i].x, x, w);
+            alignIn(item.fillY ? ALIGN_STRETCH : align, cellH, atWidth[i].y, y, h);
+            const Vector2D size = layoutConstrain(child, {w, h});
+
+            // Snap to whole pixels so neighbours don't blur or overlap
+            const double left = std::round(columnStarts[cell.column] + x), top = std::round(rowStarts[cell.row] + y);
+            m_childBoxes[i]   = CBox{left, top, std::round(size.x), std::round(size.y)};
+        }
+    }
+};
+
+CGridElement* gridFor(jlong handle) {
+    auto grid = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CGridElement>*>(handle);
+    return grid.get();
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL
+Java_org_hyprclj_bindings_Grid_00024Builder_nativeCreate(
+    JNIEnv* env, jclass clazz, jintArray columns, jintArray rows, jint rowGap, jint columnGap, jint align,
+    jint padding, jint width, jint height, jint background, jint borderColor, jint border, jint rounding) {
+
+    try {
+        auto grid = Hyprutils::Memory::makeShared<CGridElement>();
+
+        grid->m_columns   = decodeTracks(env, columns);
+        grid->m_rows      = decodeTracks(env, rows);
+        grid->m_rowGap    = (float)std::max(rowGap, 0);
+        grid->m_columnGap = (float)std::max(columnGap, 0);
+        grid->m_align     = align;
+        grid->setPadding((float)padding);
+        grid->setSize(width, height);
+        grid->setStyle((uint32_t)background, (uint32_t)borderColor, border, rounding);
+        sizeNoteFill(grid, width, height);
+
+        return reinterpret_cast<jlong>(new auto(grid));
+    } catch (const std::exception& e) {
+        return 0;
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Grid_nativeSetTracks(JNIEnv* env, jobject obj, jlong handle, jintArray columns, jintArray rows) {
+    if (auto* grid = gridFor(handle)) {
+        grid->m_columns = decodeTracks(env, columns);
+        grid->m_rows    = decodeTracks(env, rows);
+        grid->invalidate();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Grid_nativeSetGap(JNIEnv* env, jobject obj, jlong handle, jint rowGap, jint columnGap, jint padding) {
+    if (auto* grid = gridFor(handle)) {
+        grid->m_rowGap    = (float)std::max(rowGap, 0);
+        grid->m_columnGap = (float)std::max(columnGap, 0);
+        grid->setPadding((float)padding);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Grid_nativeSetAlignItems(JNIEnv* env, jobject obj, jlong handle, jint align) {
+    if (auto* grid = gridFor(handle)) {
+        grid->m_align = align;
+        grid->invalidate();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Grid_nativeSetStyle(
+    JNIEnv* env, jobject obj, jlong handle, jint background, jint borderColor, jint border, jint rounding) {
+
+    if (auto* grid = gridFor(handle)) {
+        grid->setStyle((uint32_t)background, (uint32_t)borderColor, border, rounding);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetGridCell(
+    JNIEnv* env, jobject obj, jlong handle, jint row, jint column, jint rowSpan, jint columnSpan) {
+
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    if (!element) return;
+
+    auto& item      = layoutItemFor(element);
+    item.gridRow    = std::max(row, -1);
+    item.gridColumn = std::max(column, -1);
+    item.rowSpan    = std::max(rowSpan, 1);
+    item.columnSpan = std::max(columnSpan, 1);
+
+    layoutInvalidate(element.get());
+}
+
+} // extern "C"
@@ -0,0 +1,130 @@
+#include <jni.h>
+#include <hyprtoolkit/core/Backend.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+
+using namespace Hyprtoolkit;
+
+extern JavaVM* g_jvm;
+extern JNIEnv* getEnv();
+
+// Idle queue
+//
+// Backend.addIdle callbacks are queued here and drained in FIFO order from a
+// single backend idle hook, instead of registering one hyprtoolkit idle (and
+// one lambda) per call. A drain stops once the idle budget is spent and
+// re-arms, so a burst of idle work cannot starve input.
+//
+// A callback may carry a key (non-zero): submitting another callback with a
+// key that is still pending replaces the queued one in place, so repeated
+// requests for the same work ("remount this list") run once, at the
+// position of the first request, with the latest callback.
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct SIdleTask {
+    jobject callback = nullptr; // Runnable
+    jlong   key      = 0;       // 0 when not deduplicated
+};
+
+struct SIdleQueue {
+    Hyprutils::Memory::CSharedPointer<IBackend> backend;
+    std::deque<SIdleTask>                       tasks;
+    uint64_t                                    headSeq = 0; // sequence number of tasks.front()
+    std::unordered_map<jlong, uint64_t>         pendingKeys; // key -> sequence number
+    jmethodID                                   runMethod = nullptr;
+
+    bool                                        armed = false;
+    std::chrono::milliseconds                   budget{8};
+};
+
+SIdleQueue g_idle;
+
+void drain();
+
+void arm() {
+    auto& q = g_idle;
+    if (q.armed || !q.backend) return;
+    q.armed = true;
+    q.backend->addIdle([]() { drain(); });
+}
+
+void drain() {
+    auto& q = g_idle;
+    q.armed = false;
+
+    JNIEnv*    env      = getEnv();
+    const auto deadline = Clock::now() + q.budget;
+
+    // Only run what was queued before this drain; callbacks queued by these
+    // ones wait for the next idle, so a self-rescheduling callback can't spin
+    size_t count = q.tasks.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0 && Clock::now() >= deadline) break;
+
+        SIdleTask task = q.tasks.front();
+        q.tasks.pop_front();
+        q.headSeq++;
+        if (task.key) {
+            q.pendingKeys.erase(task.key);
+        }
+
+        env->CallVoidMethod(task.callback, q.runMethod);
+        if (env->ExceptionCheck()) {
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+        }
+        env->DeleteGlobalRef(task.callback);
+    }
+
+    if (!q.tasks.empty()) {
+        arm();
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Backend_nativeAddIdle(
+    JNIEnv* env, jobject obj, jlong handle, jlong key, jobject callback) {
+
+    auto backend = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(handle);
+    if (!backend || !callback) return;
+
+    auto& q = g_idle;
+    if (!q.backend) {
+        q.backend = backend;
+    }
+    if (!q.runMethod) {
+        jclass runnableClass = env->FindClass("java/lang/Runnable");
+        q.runMethod          = env->GetMethodID(runnableClass, "run", "()V");
+    }
+
+    if (key) {
+        auto it = q.pendingKeys.find(key);
+        if (it != q.pendingKeys.end()) {
+            auto& task = q.tasks[it->second - q.headSeq];
+            env->DeleteGlobalRef(task.callback);
+            task.callback = env->NewGlobalRef(callback);
+            return;
+        }
+        q.pendingKeys[key] = q.headSeq + q.tasks.size();
+    }
+
+    q.tasks.push_back({env->NewGlobalRef(callback), key});
+    arm();
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Backend_nativeSetIdleBudget(JNIEnv* env, jclass clazz, jint budgetMs) {
+    if (budgetMs > 0) {
+        g_idle.budget = std::chrono::milliseconds(budgetMs);
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,555 @@
+#include <jni.h>
+#include <hyprtoolkit/core/CoreMacros.hpp>  // Must be included first for HT_HIDDEN
+#include <hyprtoolkit/window/Window.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hyprclj_state.hpp"
+
+using namespace Hyprtoolkit;
+
+extern JavaVM* g_jvm;
+extern JNIEnv* getEnv();
+
+// Implemented by the Textbox text model (hyprclj_textbox.cpp)
+extern bool textboxApplyKey(IElement* element, uint32_t keysym, bool pressed, const std::string& utf8, uint32_t modifiers);
+
+void inputForgetWindow(IWindow* window);
+
+// Keyboard input
+//
+// One keyboard listener per window dispatches every key event natively:
+//   1. key bindings (Window.bindKeys) - a trie of (keysym, modifiers,
+//      press/release) steps, so multi-key chords work; only a completed
+//      binding calls into Java
+//   2. Tab / Shift+Tab move focus along the window's focus chain
+//   3. the focused element gets the event - a Textbox applies it to its
+//      native text model, other elements call their registered key handler
+//      (one direct upcall; the utf8 string is only built for handlers that
+//      asked for text)
+//   4. unconsumed events go to the window's listener, only when the
+//      catch-all is enabled
+// Unbound traffic of an app that only binds shortcuts never enters the JVM.
+// Primitive handlers (KeyHandler, Window.KeyListener) fetch the typed text
+// lazily through Window.keyText() while the event is being dispatched.
+//
+// Window input is dropped when the window is closed. Key handlers are keyed
+// by element address and hold a weak pointer to their element, so a handler
+// of an element destroyed without a release is never called for a new
+// element at the same address: it is dropped on sight, and swept when a
+// window closes.
+namespace {
+
+constexpr uint32_t KEY_TAB          = 0xff09;
+constexpr uint32_t KEY_ISO_LEFT_TAB = 0xfe20;
+constexpr uint32_t MOD_SHIFT        = 1 << 0;
+constexpr uint32_t MOD_CTRL         = 1 << 2;
+constexpr uint32_t MOD_ALT          = 1 << 3;
+constexpr uint32_t MOD_SUPER        = 1 << 6;
+// Lock-type modifiers (Caps/Num Lock) never take part in matching
+constexpr uint32_t MOD_BINDING_MASK = MOD_SHIFT | MOD_CTRL | MOD_ALT | MOD_SUPER;
+
+// Pending chord prefixes expire after this long
+constexpr std::chrono::milliseconds CHORD_TIMEOUT{1000};
+
+struct SKeyNode {
+    std::unordered_map<uint64_t, std::unique_ptr<SKeyNode>> next;
+    jobject                                                 action = nullptr; // Runnable, set on binding leaves
+    int                                                     id     = 0;
+};
+
+struct SKeyHandler {
+    jobject                                   handler   = nullptr;
+    bool                                      wantsText = false;
+    Hyprutils::Memory::CWeakPointer<IElement> self;
+};
+
+struct SFocusable {
+    Hyprutils::Memory::CWeakPointer<IElement> element;
+    jlong                                     handle = 0; // reported in the window state page
+};
+
+struct SWindowInput {
+    IWindow*                                                              window = nullptr;
+    Hyprutils::Memory::CWeakPointer<IWindow>                              owner; // expired: left by a dead window
+    Hyprutils::Memory::CSharedPointer<Hyprutils::Signal::CSignalListener> listener;
+    jobject                                                               fallback = nullptr;
+    bool                                                                  fallbackText = true; // KeyboardListener vs KeyListener
+    std::vector<SFocusable>                                               chain;
+    Hyprutils::Memory::CWeakPointer<IElement>                             focused;
+    jlong                                                                 focusedHandle = 0;
+
+    SKeyNode                                                              bindings;
+    SKeyNode*                                                             chord = nullptr; // inside a chord prefix
+    std::chrono::steady_clock::time_point                                 chordTime;
+    bool                                                                  catchAll = false;
+};
+
+std::unordered_map<IWindow*, SWindowInput>  g_windowInput;
+std::unordered_map<IElement*, SKeyHandler> g_keyHandlers;
+
+jmethodID g_onKeyMethod     = nullptr; // Element$KeyHandler.onKey(IZI)Z
+jmethodID g_onTextKeyMethod = nullptr; // Element$TextKeyHandler.onKey(IZLjava/lang/String;I)Z
+jmethodID g_fallbackMethod  = nullptr; // Window$KeyboardListener.onKey(IZLjava/lang/String;I)V
+jmethodID g_keyListenerMethod = nullptr; // Window$KeyListener.onKey(IZI)V
+jmethodID g_runMethod       = nullptr; // Runnable.run()V
+int       g_nextBindingId   = 1;
+
+void cacheMethods(JNIEnv* env) {
+    if (g_onKeyMethod) return;
+
+    jclass keyHandlerClass  = env->FindClass("org/hyprclj/bindings/Element$KeyHandler");
+    g_onKeyMethod           = env->GetMethodID(keyHandlerClass, "onKey", "(IZI)Z");
+    jclass textHandlerClass = env->FindClass("org/hyprclj/bindings/Element$TextKeyHandler");
+    g_onTextKeyMethod       = env->GetMethodID(textHandlerClass, "onKey", "(IZLjava/lang/String;I)Z");
+    jclass listenerClass    = env->FindClass("org/hyprclj/bindings/Window$KeyboardListener");
+    g_fallbackMethod        = env->GetMethodID(listenerClass, "onKey", "(IZLjava/lang/String;I)V");
+    jclass keyListenerClass = env->FindClass("org/hyprclj/bindings/Window$KeyListener");
+    g_keyListenerMethod     = env->GetMethodID(keyListenerClass, "onKey", "(IZI)V");
+    jclass runnableClass    = env->FindClass("java/lang/Runnable");
+    g_runMethod             = env->GetMethodID(runnableClass, "run", "()V");
+}
+
+bool clearException(JNIEnv* env) {
+    if (!env->ExceptionCheck()) return false;
+    env->ExceptionDescribe();
+    env->ExceptionClear();
+    return true;
+}
+
+void setFocus(SWindowInput& input, Hyprutils::Memory::CWeakPointer<IElement> element, jlong handle) {
+    input.focused       = element;
+    input.focusedHandle = handle;
+    stateSetFocused(input.window, handle);
+}
+
+// Drop dead elements from the chain; returns the focused index or -1
+int compactChain(SWindowInput& input) {
+    std::erase_if(input.chain, [](const auto& entry) { return entry.element.expired(); });
+
+    auto focused = input.focused.lock();
+    if (!focused) return -1;
+
+    for (size_t i = 0; i < input.chain.size(); ++i) {
+        if (input.chain[i].element.lock() == focused) return (int)i;
+    }
+    return -1;
+}
+
+void moveFocus(SWindowInput& input, int direction) {
+    int current = compactChain(input);
+    int count   = (int)input.chain.size();
+    if (count == 0) return;
+
+    int next = current < 0 ? (direction > 0 ? 0 : count - 1) : (current + direction + count) % count;
+    setFocus(input, input.chain[next].element, input.chain[next].handle);
+}
+
+bool dispatchToFocused(SWindowInput& input, const Input::SKeyboardKeyEvent& event) {
+    auto focused = input.focused.lock();
+    if (!focused) return false;
+
+    if (textboxApplyKey(focused.get(), event.xkbKeysym, event.down, event.utf8, event.modMask)) {
+        return true;
+    }
+
+    auto it = g_keyHandlers.find(focused.get());
+    if (it == g_keyHandlers.end()) return false;
+
+    JNIEnv* env = getEnv();
+    if (it->second.self.lock() != focused) {
+        // Left by a dead element at the same address
+        if (it->second.handler) env->DeleteGlobalRef(it->second.handler);
+        g_keyHandlers.erase(it);
+        return false;
+    }
+    if (!it->second.handler) return false;
+
+    jboolean consumed = false;
+
+    if (it->second.wantsText) {
+        jstring utf8 = env->NewStringUTF(event.utf8.c_str());
+        consumed     = env->CallBooleanMethod(it->second.handler, g_onTextKeyMethod,
+                                              (jint)event.xkbKeysym, (jboolean)event.down, utf8, (jint)event.modMask);
+        env->DeleteLocalRef(utf8);
+    } else {
+        consumed = env->CallBooleanMethod(it->second.handler, g_onKeyMethod,
+                                          (jint)event.xkbKeysym, (jboolean)event.down, (jint)event.modMask);
+    }
+
+    return !clearException(env) && consumed;
+}
+
+// One trie step: keysym, binding-relevant modifiers, press or release.
+// Letters are folded to lowercase - Shift is carried by the modifiers.
+uint64_t stepKey(uint32_t keysym, uint32_t modifiers, bool release) {
+    if (keysym >= 'A' && keysym <= 'Z') {
+        keysym += 'a' - 'A';
+    }
+    return ((uint64_t)keysym << 32) | ((uint64_t)(modifiers & MOD_BINDING_MASK) << 1) | (release ? 1 : 0);
+}
+
+bool isModifierKeysym(uint32_t keysym) {
+    return keysym >= 0xffe1 && keysym <= 0xffee; // Shift_L .. Hyper_R
+}
+
+bool dispatchBinding(SWindowInput& input, const Input::SKeyboardKeyEvent& event) {
+    if (input.bindings.next.empty() || isModifierKeysym(event.xkbKeysym)) return false;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (input.chord && now - input.chordTime > CHORD_TIMEOUT) {
+        input.chord = nullptr;
+    }
+
+    const uint64_t step = stepKey(event.xkbKeysym, event.modMask, !event.down);
+    SKeyNode*      from = input.chord ? input.chord : &input.bindings;
+    auto           it   = from->next.find(step);
+
+    if (it == from->next.end()) {
+        // Releases of chord keys don't break a chord in progress
+        if (!event.down) return input.chord != nullptr;
+
+        // A wrong key aborts the chord; it may still start a new binding
+        if (!input.chord) return false;
+        input.chord = nullptr;
+        it          = input.bindings.next.find(step);
+        if (it == input.bindings.next.end()) return false;
+    }
+
+    SKeyNode* node = it->second.get();
+    if (node->action) {
+        input.chord  = nullptr;
+        JNIEnv* env  = getEnv();
+        env->CallVoidMethod(node->action, g_runMethod);
+        clearException(env);
+        return true;
+    }
+
+    // Chord prefix: wait for the next step
+    input.chord     = node;
+    input.chordTime = now;
+    return true;
+}
+
+bool unbind(JNIEnv* env, SKeyNode& node, int id) {
+    for (auto it = node.next.begin(); it != node.next.end(); ++it) {
+        SKeyNode& child = *it->second;
+        if (child.id == id && child.action) {
+            env->DeleteGlobalRef(child.action);
+            child.action = nullptr;
+            child.id     = 0;
+        } else if (!unbind(env, child, id)) {
+            continue;
+        }
+        if (!child.action && child.next.empty()) {
+            node.next.erase(it);
+        }
+        return true;
+    }
+    return false;
+}
+
+// Delete the actions of a bindings trie
+void releaseBindings(JNIEnv* env, SKeyNode& node) {
+    for (auto& [step, child] : node.next) {
+        if (child->action) env->DeleteGlobalRef(child->action);
+        releaseBindings(env, *child);
+    }
+    node.next.clear();
+}
+
+void dispatchKey(IWindow* window, const Input::SKeyboardKeyEvent& event) {
+    auto it = g_windowInput.find(window);
+    if (it == g_windowInput.end()) return;
+    auto& input = it->second;
+
+    stateSetModifiers(window, event.modMask);
+
+    if (dispatchBinding(input, event)) return;
+
+    if ((event.xkbKeysym == KEY_TAB || event.xkbKeysym == KEY_ISO_LEFT_TAB) && !input.chain.empty()) {
+        if (event.down) {
+            const bool back = event.xkbKeysym == KEY_ISO_LEFT_TAB || (event.modMask & MOD_SHIFT);
+            moveFocus(input, back ? -1 : 1);
+        }
+        return;
+    }
+
+    if (dispatchToFocused(input, event)) return;
+
+    if (input.fallback && input.catchAll) {
+        JNIEnv* env = getEnv();
+        if (input.fallbackText) {
+            jstring utf8 = env->NewStringUTF(event.utf8.c_str());
+            env->CallVoidMethod(input.fallback, g_fallbackMethod,
+                                (jint)event.xkbKeysym, (jboolean)event.down, utf8, (jint)event.modMask);
+            env->DeleteLocalRef(utf8);
+        } else {
+            env->CallVoidMethod(input.fallback, g_keyListenerMethod,
+                                (jint)event.xkbKeysym, (jboolean)event.down, (jint)event.modMask);
+        }
+        clearException(env);
+    }
+}
+
+// Text of the event being dispatched, for Window.keyText()
+const std::string* g_dispatchText = nullptr;
+
+// Input state for a window, installing its keyboard listener on first use
+SWindowInput& inputFor(JNIEnv* env, const Hyprutils::Memory::CSharedPointer<IWindow>& window) {
+    cacheMethods(env);
+
+    auto stale = g_windowInput.find(window.get());
+    if (stale != g_windowInput.end() && stale->second.owner.lock() != window) {
+        inputForgetWindow(window.get());
+    }
+
+    auto& input = g_windowInput[window.get()];
+    if (!input.listener) {
+        input.window   = window.get();
+        input.owner    = window;
+        IWindow* raw   = window.get();
+        input.listener = window->m_events.keyboardKey.listen([raw](const Input::SKeyboardKeyEvent& event) {
+            g_dispatchText = &event.utf8;
+            dispatchKey(raw, event);
+            g_dispatchText = nullptr;
+        });
+    }
+    return input;
+}
+
+IElement* elementFor(jlong handle) {
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    return element.get();
+}
+
+} // namespace
+
+// Handle passed when the focused element was focused (hyprclj_state.cpp)
+jlong inputFocusedHandle(IWindow* window) {
+    auto it = g_windowInput.find(window);
+    if (it == g_windowInput.end() || it->second.focused.expired()) return 0;
+    return it->second.focusedHandle;
+}
+
+// Called when an element is released / recycled (hyprclj_pool.cpp)
+void inputForgetElement(IElement* element) {
+    auto it = g_keyHandlers.find(element);
+    if (it == g_keyHandlers.end()) return;
+
+    if (it->second.handler) {
+        getEnv()->DeleteGlobalRef(it->second.handler);
+    }
+    g_keyHandlers.erase(it);
+}
+
+// Called when a window is closed (hyprclj_window.cpp)
+void inputForgetWindow(IWindow* window) {
+    JNIEnv* env = getEnv();
+
+    auto it = g_windowInput.find(window);
+    if (it != g_windowInput.end()) {
+        if (it->second.fallback) env->DeleteGlobalRef(it->second.fallback);
+        releaseBindings(env, it->second.bindings);
+        g_windowInput.erase(it);
+    }
+
+    // Its elements may be gone without a release
+    std::erase_if(g_keyHandlers, [env](const auto& entry) {
+        if (!entry.second.self.expired()) return false;
+        if (entry.second.handler) env->DeleteGlobalRef(entry.second.handler);
+        return true;
+    });
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeSetKeyboardCallback(
+    JNIEnv* env, jobject obj, jlong handle, jobject listener) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window) return;
+
+    auto& input = inputFor(env, window);
+    if (input.fallback) {
+        env->DeleteGlobalRef(input.fallback);
+    }
+    input.fallback     = listener ? env->NewGlobalRef(listener) : nullptr;
+    input.fallbackText = true;
+    input.catchAll     = listener != nullptr;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeSetKeyListener(
+    JNIEnv* env, jobject obj, jlong handle, jobject listener) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window) return;
+
+    auto& input = inputFor(env, window);
+    if (input.fallback) {
+        env->DeleteGlobalRef(input.fallback);
+    }
+    input.fallback     = listener ? env->NewGlobalRef(listener) : nullptr;
+    input.fallbackText = false;
+    input.catchAll     = listener != nullptr;
+}
+
+JNIEXPORT jstring JNICALL
+Java_org_hyprclj_bindings_Window_nativeKeyText(JNIEnv* env, jclass clazz) {
+    // Only meaningful inside a key callback
+    if (!g_dispatchText || g_dispatchText->empty()) return nullptr;
+    return env->NewStringUTF(g_dispatchText->c_str());
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeSetCatchAll(
+    JNIEnv* env, jobject obj, jlong handle, jboolean enabled) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window) return;
+
+    inputFor(env, window).catchAll = enabled;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Window_nativeBindKeys(
+    JNIEnv* env, jobject obj, jlong handle,
+    jintArray keysyms, jintArray modifiers, jboolean onRelease, jobject action) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window || !action) return 0;
+
+    const jsize count = env->GetArrayLength(keysyms);
+    if (count == 0 || env->GetArrayLength(modifiers) != count) return 0;
+
+    std::vector<jint> syms(count), mods(count);
+    env->GetIntArrayRegion(keysyms, 0, count, syms.data());
+    env->GetIntArrayRegion(modifiers, 0, count, mods.data());
+
+    auto&     input = inputFor(env, window);
+    SKeyNode* node  = &input.bindings;
+    for (jsize i = 0; i < count; ++i) {
+        // Only the final step of a chord can fire on release
+        auto& next = node->next[stepKey((uint32_t)syms[i], (uint32_t)mods[i], onRelease && i == count - 1)];
+        if (!next) {
+            next = std::make_unique<SKeyNode>();
+        }
+        node = next.get();
+    }
+
+    // Rebinding the same sequence replaces the old action
+    if (node->action) {
+        env->DeleteGlobalRef(node->action);
+    }
+    node->action = env->NewGlobalRef(action);
+    node->id     = g_nextBindingId++;
+    input.chord  = nullptr;
+    return node->id;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeUnbindKeys(
+    JNIEnv* env, jobject obj, jlong handle, jint id) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window) return;
+
+    auto& input = inputFor(env, window);
+    input.chord = nullptr;
+    unbind(env, input.bindings, id);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeAddFocusable(
+    JNIEnv* env, jobject obj, jlong handle, jlong elementHandle) {
+
+    auto window  = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(elementHandle);
+    if (!window || !element) return;
+
+    auto& input = inputFor(env, window);
+    compactChain(input);
+    for (const auto& entry : input.chain) {
+        if (entry.element.lock() == element) return;
+    }
+    input.chain.push_back(SFocusable{element, elementHandle});
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeRemoveFocusable(
+    JNIEnv* env, jobject obj, jlong handle, jlong elementHandle) {
+
+    auto window  = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(elementHandle);
+    if (!window || !element) return;
+
+    auto& input = inputFor(env, window);
+    std::erase_if(input.chain, [&](const auto& entry) {
+        return entry.element.expired() || entry.element.lock() == element;
+    });
+    if (input.focused.lock() == element) {
+        setFocus(input, {}, 0);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeFocus(
+    JNIEnv* env, jobject obj, jlong handle, jlong elementHandle) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window) return;
+
+    auto& input = inputFor(env, window);
+    if (elementHandle == 0) {
+        setFocus(input, {}, 0);
+        return;
+    }
+    setFocus(input, *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(elementHandle), elementHandle);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeMoveFocus(
+    JNIEnv* env, jobject obj, jlong handle, jint direction) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window) return;
+
+    moveFocus(inputFor(env, window), direction < 0 ? -1 : 1);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Window_nativeIsFocused(
+    JNIEnv* env, jobject obj, jlong handle, jlong elementHandle) {
+
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window || elementHandle == 0) return false;
+
+    auto it = g_windowInput.find(window.get());
+    if (it == g_windowInput.end()) return false;
+
+    auto focused = it->second.focused.lock();
+    return focused && focused.get() == elementFor(elementHandle);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetKeyHandler(
+    JNIEnv* env, jobject obj, jlong handle, jobject handler, jboolean wantsText) {
+
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    if (!element) return;
+
+    cacheMethods(env);
+    inputForgetElement(element.get());
+    if (handler) {
+        g_keyHandlers[element.get()] = SKeyHandler{env->NewGlobalRef(handler), (bool)wantsText, element};
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,555 @@
+#include <jni.h>
+#include <hyprtoolkit/core/CoreMacros.hpp>  // Must be included first for HT_HIDDEN
+#include <hyprtoolkit/element/Button.hpp>
+#include <hyprtoolkit/element/Checkbox.hpp>
+#include <hyprtoolkit/element/ColumnLayout.hpp>
+#include <hyprtoolkit/element/Line.hpp>
+#include <hyprtoolkit/element/Rectangle.hpp>
+#include <hyprtoolkit/element/RowLayout.hpp>
+#include <hyprtoolkit/element/ScrollArea.hpp>
+#include <hyprtoolkit/element/Text.hpp>
+#include <hyprtoolkit/element/Textbox.hpp>
+#include <hyprtoolkit/palette/Color.hpp>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "hyprclj_layout.hpp"
+#include "hyprclj_scheduler.hpp"
+#include "hyprclj_textcache.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::CBox;
+using Hyprutils::Math::Vector2D;
+
+// Layout support
+//
+// Size specs let an axis be sized in pixels, as a percentage of the parent,
+// by content (auto) or to fill the parent. Builders hand percentages to
+// hyprtoolkit as HT_SIZE_PERCENT, so a window resize is resolved natively
+// without re-rendering from Clojure. FILL is 100% of the parent for
+// hyprtoolkit layouts; native containers instead grow (main axis) or
+// stretch (cross axis) the element into the space left by its siblings.
+//
+// Per-element layout state (flex item properties, min/max constraints,
+// fill axes, parent link) lives in one table keyed by element. It is
+// dropped when the element is released or recycled, or when one of our own
+// element types is destroyed. Entries of hyprtoolkit elements that die
+// without a release are recognised by their expired owner pointer: dropped
+// when looked up, and swept when the table has doubled since the last
+// sweep.
+//
+// Layout is incremental. Containers measure children through a per-element
+// cache (last two constraints -> sizes), so repeated passes with identical
+// constraints don't re-measure (text elements also share measurements of
+// the same text across elements). A change drops the cache of the element and
+// of its ancestors only and marks them dirty; a clean container given the
+// same box again skips measuring and arranging, and only hands its
+// children their previous boxes.
+//
+// Relayout is deferred to the frame scheduler: any number of changes
+// before the next frame (N children added, a render touching k props)
+// cost one pass of the outermost dirty container.
+SLayoutStats g_layoutStats;
+
+namespace {
+
+constexpr double UNBOUNDED = std::numeric_limits<double>::max();
+
+std::unordered_map<IElement*, SLayoutItem> g_items;
+size_t                                     g_sweepAt = 1024;
+
+// The live entry of an element, or nullptr
+SLayoutItem* findItem(IElement* element) {
+    auto it = g_items.find(element);
+    if (it == g_items.end()) return nullptr;
+
+    if (it->second.self.get() != element) {
+        g_items.erase(it);
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void sweepItems() {
+    std::erase_if(g_items, [](const auto& entry) { return entry.second.self.get() != entry.first; });
+    g_sweepAt = std::max<size_t>(1024, g_items.size() * 2);
+}
+
+template <typename T>
+bool rebuildSize(IElement* element, const CDynamicSize& size) {
+    auto* typed = dynamic_cast<T*>(element);
+    if (!typed) return false;
+    typed->rebuild()->size(CDynamicSize(size))->commence();
+    return true;
+}
+
+CHyprColor unpackColor(uint32_t rgba) {
+    return CHyprColor{(float)((rgba >> 24) & 0xFF) / 255.0f, (float)((rgba >> 16) & 0xFF) / 255.0f,
+                      (float)((rgba >> 8) & 0xFF) / 255.0f, (float)(rgba & 0xFF) / 255.0f};
+}
+
+bool sameBox(const CBox& a, const CBox& b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+void dropMeasurements(IElement* element) {
+    if (auto* item = findItem(element)) {
+        item->preferred.clear();
+        item->minimum.clear();
+    }
+}
+
+std::optional<Vector2D> measureText(IElement* element, const STextStyle& style, const Vector2D& constraints) {
+    if (auto size = textCacheFind(style, constraints)) {
+        return size;
+    }
+
+    auto size = element->preferredSize(constraints);
+    if (size) {
+        textCacheStore(style, constraints, *size);
+    }
+    return size;
+}
+
+std::optional<Vector2D> measureCached(IElement* element, const Vector2D& constraints, bool minimum) {
+    std::optional<STextStyle> text;
+    if (const auto* item = findItem(element)) {
+        const auto& cache = minimum ? item->minimum : item->preferred;
+        if (const auto* hit = cache.find(constraints)) {
+            g_layoutStats.cacheHits++;
+            return hit->size;
+        }
+        if (!minimum && !item->sized) text = item->text;
+    }
+
+    g_layoutStats.measured++;
+    const auto size = minimum ? element->minimumSize(constraints) :
+        text                  ? measureText(element, *text, constraints) :
+                                element->preferredSize(constraints);
+
+    // Measuring may have added items: look ours up again. Children always
+    // have an entry (added through the hooks); anything else isn't cached.
+    if (auto* item = findItem(element)) {
+        auto& cache = minimum ? item->minimum : item->preferred;
+        cache.store(constraints, size);
+    }
+    return size;
+}
+
+void detach(IElement* child, IElement* parent) {
+    auto* item = findItem(child);
+    if (item && item->parent.get() == parent) {
+        item->parent.reset();
+    }
+}
+
+// Drop the measurements of element's ancestors up to the nearest native
+// container, and invalidate that one (it carries on upwards)
+void invalidateAncestors(IElement* element) {
+    for (auto parent = layoutItemOf(element).parent.lock(); parent; parent = layoutItemOf(parent.get()).parent.lock()) {
+        if (auto* container = dynamic_cast<CLayoutContainer*>(parent.get())) {
+            container->invalidate();
+            return;
+        }
+        dropMeasurements(parent.get());
+    }
+}
+
+} // namespace
+
+SSizeSpec SSizeSpec::decode(jint spec) {
+    // Legacy -1 (and any negative value) means auto
+    if (spec < 0) return {SIZE_AUTO, 0};
+
+    const int mode  = (spec >> 24) & 0xFF;
+    const int value = spec & 0xFFFFFF;
+    switch (mode) {
+        case SIZE_PX: return {SIZE_PX, (double)value};
+        case SIZE_PERCENT: return {SIZE_PERCENT, value / 10000.0};
+        case SIZE_FILL: return {SIZE_FILL, 1.0};
+        default: return {SIZE_AUTO, 0};
+    }
+}
+
+std::optional<double> SSizeSpec::resolve(double available) const {
+    switch (mode) {
+        case SIZE_PX: return value;
+        case SIZE_PERCENT:
+        case SIZE_FILL: return available > 0 ? std::optional<double>(available * value) : std::nullopt;
+        default: return std::nullopt;
+    }
+}
+
+bool sizeSpecified(jint width, jint height) {
+    return SSizeSpec::decode(width).mode != SIZE_AUTO || SSizeSpec::decode(height).mode != SIZE_AUTO;
+}
+
+CDynamicSize sizeFromSpec(jint width, jint height) {
+    auto axis = [](const SSizeSpec& spec) {
+        switch (spec.mode) {
+            case SIZE_PX: return CDynamicSize::HT_SIZE_ABSOLUTE;
+            case SIZE_PERCENT:
+            case SIZE_FILL: return CDynamicSize::HT_SIZE_PERCENT;
+            default: return CDynamicSize::HT_SIZE_AUTO;
+        }
+    };
+
+    const auto w = SSizeSpec::decode(width), h = SSizeSpec::decode(height);
+    return CDynamicSize(axis(w), axis(h), Vector2D{w.value, h.value});
+}
+
+void sizeNoteFill(const Hyprutils::Memory::CSharedPointer<IElement>& element, jint width, jint height) {
+    if (!element) return;
+
+    const bool fillX = SSizeSpec::decode(width).mode == SIZE_FILL;
+    const bool fillY = SSizeSpec::decode(height).mode == SIZE_FILL;
+
+    if (!findItem(element.get()) && !fillX && !fillY) return;
+
+    auto& item = layoutItemFor(element);
+    item.fillX = fillX;
+    item.fillY = fillY;
+}
+
+bool sizeApply(const Hyprutils::Memory::CSharedPointer<IElement>& element, jint width, jint height) {
+    IElement* raw = element.get();
+
+    if (auto* container = dynamic_cast<CLayoutContainer*>(raw)) {
+        sizeNoteFill(element, width, height);
+        container->setSize(width, height);
+        return true;
+    }
+
+    if (canvasSetSize(raw, width, height)) {
+        sizeNoteFill(element, width, height);
+        layoutInvalidate(raw);
+        return true;
+    }
+
+    const auto size    = sizeFromSpec(width, height);
+    const bool applied = rebuildSize<CButtonElement>(raw, size) || rebuildSize<CTextElement>(raw, size) ||
+        rebuildSize<CRectangleElement>(raw, size) || rebuildSize<CColumnLayoutElement>(raw, size) ||
+        rebuildSize<CRowLayoutElement>(raw, size) || rebuildSize<CScrollAreaElement>(raw, size) ||
+        rebuildSize<CTextboxElement>(raw, size) || rebuildSize<CCheckboxElement>(raw, size) ||
+        rebuildSize<CLineElement>(raw, size);
+
+    if (applied) {
+        sizeNoteFill(element, width, height);
+        if (dynamic_cast<CTextElement*>(raw)) {
+            layoutItemFor(element).sized = sizeSpecified(width, height);
+        }
+        layoutInvalidate(raw);
+    }
+    return applied;
+}
+
+const SLayoutItem& layoutItemOf(IElement* element) {
+    static const SLayoutItem defaults;
+    const auto*              item = findItem(element);
+    return item ? *item : defaults;
+}
+
+SLayoutItem& layoutItemFor(const Hyprutils::Memory::CSharedPointer<IElement>& element) {
+    if (auto* item = findItem(element.get())) return *item;
+
+    if (g_items.size() >= g_sweepAt) {
+        sweepItems();
+    }
+    auto& item = g_items[element.get()];
+    item.self  = element;
+    return item;
+}
+
+Vector2D layoutConstrain(IElement* element, Vector2D size) {
+    const auto& item = layoutItemOf(element);
+    if (item.maxSize.x >= 0) size.x = std::min(size.x, item.maxSize.x);
+    if (item.maxSize.y >= 0) size.y = std::min(size.y, item.maxSize.y);
+    if (item.minSize.x >= 0) size.x = std::max(size.x, item.minSize.x);
+    if (item.minSize.y >= 0) size.y = std::max(size.y, item.minSize.y);
+    return size;
+}
+
+std::optional<Vector2D> layoutPreferred(IElement* element, const Vector2D& constraints) {
+    return measureCached(element, constraints, false);
+}
+
+std::optional<Vector2D> layoutMinimum(IElement* element, const Vector2D& constraints) {
+    return measureCached(element, constraints, true);
+}
+
+void layoutInvalidate(IElement* element) {
+    if (auto* container = dynamic_cast<CLayoutContainer*>(element)) {
+        container->invalidate();
+        return;
+    }
+
+    dropMeasurements(element);
+    invalidateAncestors(element);
+}
+
+// ===== CLayoutContainer =====
+
+CLayoutContainer::~CLayoutContainer() {
+    for (auto& child : m_children) {
+        detach(child.get(), this);
+    }
+    g_items.erase(this);
+    schedulerCancel(this);
+}
+
+void CLayoutContainer::paint() {
+    // Background and children paint themselves
+}
+
+void CLayoutContainer::reposition(const CBox& box, const Vector2D& maxSize) {
+    // Nothing changed since the last pass: the arrangement holds. A child
+    // may still have changed on its own (a textbox being typed into, a
+    // rebuilt label), so each one is handed its box again to re-place its
+    // content; native containers among them skip the same way.
+    if (m_placed && !m_dirty && sameBox(box, m_box) && maxSize == m_maxSize) {
+        g_layoutStats.skipped++;
+        if (m_placedBoxes.size() == m_children.size()) {
+            for (size_t i = 0; i < m_children.size(); ++i) {
+                m_children[i]->reposition(m_placedBoxes[i], {m_placedBoxes[i].w, m_placedBoxes[i].h});
+            }
+        }
+        return;
+    }
+
+    IElement::reposition(box, maxSize);
+    m_box     = box;
+    m_maxSize = maxSize;
+    m_placed  = true;
+
+    if (m_backgroundRect) {
+        m_backgroundRect->reposition(box, {box.w, box.h});
+    }
+
+    const CBox inner = {box.x + m_padding, box.y + m_padding, std::max(0.0, box.w - m_padding * 2),
+                        std::max(0.0, box.h - m_padding * 2)};
+    g_layoutStats.relayouts++;
+    m_placedBoxes.resize(m_children.size());
+    layoutChildren(inner, m_dirty || !sameBox(inner, m_lastInner));
+    m_lastInner = inner;
+    m_dirty     = false;
+}
+
+void CLayoutContainer::placeChild(size_t i, const CBox& box) {
+    m_placedBoxes[i] = box;
+    m_children[i]->reposition(box, {box.w, box.h});
+}
+
+Vector2D CLayoutContainer::resolveSize(const Vector2D& parent, const Vector2D& content) const {
+    const auto w = m_width.resolve(parent.x), h = m_height.resolve(parent.y);
+    return {w.value_or(content.x), h.value_or(content.y)};
+}
+
+std::optional<Vector2D> CLayoutContainer::preferredSize(const Vector2D& parent) {
+    // Measure content in the space our own size leaves it
+    const Vector2D outer   = resolveSize(parent, parent);
+    const Vector2D inner   = {std::max(0.0, outer.x - m_padding * 2), std::max(0.0, outer.y - m_padding * 2)};
+    const Vector2D content = contentSize(inner) + Vector2D{m_padding * 2, m_padding * 2};
+
+    return layoutConstrain(this, resolveSize(parent, content));
+}
+
+std::optional<Vector2D> CLayoutContainer::minimumSize(const Vector2D& parent) {
+    const Vector2D inner   = {std::max(0.0, parent.x - m_padding * 2), std::max(0.0, parent.y - m_padding * 2)};
+    const Vector2D content = contentMinimum(inner) + Vector2D{m_padding * 2, m_padding * 2};
+
+    Vector2D size = content;
+    if (m_width.mode == SIZE_PX) size.x = m_width.value;
+    if (m_height.mode == SIZE_PX) size.y = m_height.value;
+    return layoutConstrain(this, size);
+}
+
+std::optional<Vector2D> CLayoutContainer::maximumSize(const Vector2D& parent) {
+    const auto& item = layoutItemOf(this);
+
+    Vector2D size = {item.maxSize.x >= 0 ? item.maxSize.x : UNBOUNDED, item.maxSize.y >= 0 ? item.maxSize.y : UNBOUNDED};
+    if (m_width.mode == SIZE_PX) size.x = m_width.value;
+    if (m_height.mode == SIZE_PX) size.y = m_height.value;
+
+    if (size.x == UNBOUNDED && size.y == UNBOUNDED) return std::nullopt;
+    return size;
+}
+
+void CLayoutContainer::childAdded(const Hyprutils::Memory::CSharedPointer<IElement>& child) {
+    m_children.emplace_back(child);
+    invalidate();
+}
+
+void CLayoutContainer::childrenAdded(const std::vector<Hyprutils::Memory::CSharedPointer<IElement>>& children) {
+    m_children.insert(m_children.end(), children.begin(), children.end());
+    invalidate();
+}
+
+void CLayoutContainer::childRemoved(IElement* child) {
+    std::erase_if(m_children, [child](const auto& c) { return c.get() == child; });
+    detach(child, this);
+    invalidate();
+}
+
+void CLayoutContainer::childrenCleared() {
+    for (auto& child : m_children) {
+        detach(child.get(), this);
+    }
+    m_children.clear();
+
+    // clearChildren() took the background with it
+    if (m_backgroundRect) {
+        IElement::addChild(m_backgroundRect);
+    }
+    invalidate();
+}
+
+void CLayoutContainer::invalidate() {
+    m_dirty = true;
+    dropMeasurements(this);
+
+    // Every ancestor's measurements depend on ours; the outermost native
+    // container among them lays out again (and re-places the rest)
+    CLayoutContainer* root = this;
+    for (auto parent = layoutItemOf(this).parent.lock(); parent; parent = layoutItemOf(parent.get()).parent.lock()) {
+        dropMeasurements(parent.get());
+        if (auto* container = dynamic_cast<CLayoutContainer*>(parent.get())) {
+            container->m_dirty = true;
+            root               = container;
+        }
+    }
+    if (root->m_placed) {
+        schedulerRequest(root, [root]() { root->relayout(); });
+    }
+}
+
+void CLayoutContainer::relayout() {
+    // Placed again by its parent since the request: nothing left to do
+    if (m_placed && m_dirty) {
+        reposition(m_box, m_maxSize);
+    }
+}
+
+void CLayoutContainer::setSize(jint width, jint height) {
+    m_width  = SSizeSpec::decode(width);
+    m_height = SSizeSpec::decode(height);
+    invalidate();
+}
+
+void CLayoutContainer::setPadding(float padding) {
+    m_padding = std::max(padding, 0.0f);
+    invalidate();
+}
+
+void CLayoutContainer::setStyle(uint32_t background, uint32_t borderColor, int border, int rounding) {
+    m_background  = background;
+    m_borderColor = borderColor;
+    m_border      = std::max(border, 0);
+    m_rounding    = std::max(rounding, 0);
+
+    if (!m_backgroundRect) {
+        const bool wanted = (m_background & 0xFF) || (m_border > 0 && (m_borderColor & 0xFF));
+        if (!wanted) return;
+
+        m_backgroundRect = CRectangleBuilder::begin()->commence();
+        // The background must paint first: put it ahead of existing children
+        for (auto& child : m_children) {
+            IElement::removeChild(child);
+        }
+        IElement::addChild(m_backgroundRect);
+        for (auto& child : m_children) {
+            IElement::addChild(child);
+        }
+    }
+
+    m_backgroundRect->rebuild()
+        ->color([background]() { return unpackColor(background); })
+        ->borderColor([borderColor]() { return unpackColor(borderColor); })
+        ->borderThickness(m_border)
+        ->rounding(m_rounding)
+        ->commence();
+
+    if (m_placed) {
+        m_backgroundRect->reposition(m_box, {m_box.w, m_box.h});
+    }
+}
+
+// ===== Hooks =====
+
+void layoutChildAdded(const Hyprutils::Memory::CSharedPointer<IElement>& parent,
+                      const Hyprutils::Memory::CSharedPointer<IElement>& child) {
+    layoutItemFor(child).parent = parent;
+
+    if (auto* container = dynamic_cast<CLayoutContainer*>(parent.get())) {
+        container->childAdded(child);
+    } else {
+        // A hyprtoolkit layout grew: its size may feed a native container
+        layoutInvalidate(parent.get());
+    }
+}
+
+void layoutChildrenAdded(const Hyprutils::Memory::CSharedPointer<IElement>&              parent,
+                         const std::vector<Hyprutils::Memory::CSharedPointer<IElement>>& children) {
+    for (const auto& child : children) {
+        layoutItemFor(child).parent = parent;
+    }
+
+    if (auto* container = dynamic_cast<CLayoutContainer*>(parent.get())) {
+        container->childrenAdded(children);
+    } else {
+        layoutInvalidate(parent.get());
+    }
+}
+
+void layoutChildRemoved(IElement* parent, IElement* child) {
+    if (auto* container = dynamic_cast<CLayoutContainer*>(parent)) {
+        container->childRemoved(child);
+    } else {
+        detach(child, parent);
+        layoutInvalidate(parent);
+    }
+}
+
+void layoutChildrenCleared(IElement* parent) {
+    if (auto* container = dynamic_cast<CLayoutContainer*>(parent)) {
+        container->childrenCleared();
+    } else {
+        // hyprtoolkit doesn't list the children it dropped
+        for (auto& [element, item] : g_items) {
+            if (item.parent.get() == parent) item.parent.reset();
+        }
+        layoutInvalidate(parent);
+    }
+}
+
+void layoutForgetElement(IElement* element) {
+    g_items.erase(element);
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetSizeConstraints(
+    JNIEnv* env, jobject obj, jlong handle, jint minWidth, jint minHeight, jint maxWidth, jint maxHeight) {
+
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    if (!element) return;
+
+    auto& item   = layoutItemFor(element);
+    item.minSize = {(double)minWidth, (double)minHeight};
+    item.maxSize = {(double)maxWidth, (double)maxHeight};
+
+    layoutInvalidate(element.get());
+}
+
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Element_nativeLayoutStats(JNIEnv* env, jclass clazz) {
+    const jlong values[4] = {(jlong)g_layoutStats.measured, (jlong)g_layoutStats.cacheHits,
+                             (jlong)g_layoutStats.relayouts, (jlong)g_layoutStats.skipped};
+
+    jlongArray result = env->NewLongArray(4);
+    env->SetLongArrayRegion(result, 0, 4, values);
+    return result;
+}
+
+} // extern "C"
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <jni.h>
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprtoolkit/element/Rectangle.hpp>
+#include <hyprtoolkit/types/SizeType.hpp>
+#include <hyprutils/math/Box.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Native layout (hyprclj_layout.cpp)
+//
+// Size specs, per-element layout state and measure cache, and the base
+// class of the native layout containers (hyprclj_flex.cpp, hyprclj_grid.cpp).
+
+// Size specs: one jint per axis, (mode << 24) | value.
+// Keep in sync with Size.java
+enum eSizeMode : int {
+    SIZE_PX = 0,
+    SIZE_PERCENT, // value in hundredths of a percent
+    SIZE_AUTO,
+    SIZE_FILL,
+};
+
+struct SSizeSpec {
+    eSizeMode mode  = SIZE_AUTO;
+    double    value = 0; // px, or a fraction of the parent for SIZE_PERCENT
+
+    static SSizeSpec decode(jint spec);
+
+    // Size within available space; nullopt when sized by content
+    std::optional<double> resolve(double available) const;
+};
+
+// Whether either axis is sized explicitly
+bool sizeSpecified(jint width, jint height);
+
+// hyprtoolkit size for a pair of specs; FILL becomes 100% of the parent
+Hyprtoolkit::CDynamicSize sizeFromSpec(jint width, jint height);
+
+// Remember FILL axes so native containers grow / stretch the element
+void sizeNoteFill(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& element, jint width, jint height);
+
+// Resize an element in place through its builder (Element.setSize)
+bool sizeApply(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& element, jint width, jint height);
+
+// Set a canvas's size specs; false if the element is not a canvas
+// (hyprclj_canvas.cpp)
+bool canvasSetSize(Hyprtoolkit::IElement* element, jint width, jint height);
+
+// Keep in sync with Flex.ALIGN_*
+enum eLayoutAlign : int {
+    ALIGN_AUTO = -1, // per-child only: use the container's
+    ALIGN_START = 0,
+    ALIGN_CENTER,
+    ALIGN_END,
+    ALIGN_STRETCH,
+};
+
+class CLayoutContainer;
+
+// What a text element shows. Its preferred size is measured through the
+// shared text cache (hyprclj_textcache.cpp) instead of the element.
+struct STextStyle {
+    std::string content, font;
+    float       size = 0;
+
+    bool operator==(const STextStyle&) const = default;
+};
+
+// Last constraints -> last measured size, for the last two constraints:
+// containers that measure a child at the full inner size and again at the
+// width it gets (grid columns, wrapping text) hit on both every pass
+struct SMeasureCache {
+    struct SEntry {
+        Hyprutils::Math::Vector2D                constraints;
+        std::optional<Hyprutils::Math::Vector2D> size;
+        bool                                     valid = false;
+    };
+
+    std::array<SEntry, 2> entries;
+    size_t                next = 0; // entry the next store replaces
+
+    const SEntry* find(const Hyprutils::Math::Vector2D& constraints) const {
+        for (const auto& e : entries) {
+            if (e.valid && e.constraints == constraints) return &e;
+        }
+        return nullptr;
+    }
+
+    void store(const Hyprutils::Math::Vector2D& constraints, const std::optional<Hyprutils::Math::Vector2D>& size) {
+        entries[next] = {constraints, size, true};
+        next          = (next + 1) % entries.size();
+    }
+
+    void clear() {
+        entries = {};
+        next    = 0;
+    }
+};
+
+// Per-element layout state. Set on the element itself, so it applies in
+// whichever container the element is added to.
+struct SLayoutItem {
+    // Flex item (Element.setFlexItem)
+    float grow      = 0;
+    float shrink    = 1;
+    float basis     = -1; // px; -1 = preferred size
+    int   alignSelf = ALIGN_AUTO;
+
+    // Element.setSizeConstraints; -1 = unconstrained
+    Hyprutils::Math::Vector2D minSize = {-1, -1};
+    Hyprutils::Math::Vector2D maxSize = {-1, -1};
+
+    // Grid cell (Element.setGridCell); -1 = placed automatically
+    int gridRow    = -1;
+    int gridColumn = -1;
+    int rowSpan    = 1;
+    int columnSpan = 1;
+
+    bool fillX = false, fillY = false;
+
+    SMeasureCache             preferred, minimum;
+    std::optional<STextStyle> text;
+    // Sized explicitly (Element.setSize): a text element's size is then
+    // its own, not the shared measurement of its text
+    bool                      sized = false;
+
+    // Element this one was last added to, of any type (Element.addChild)
+    Hyprutils::Memory::CWeakPointer<Hyprtoolkit::IElement> parent;
+
+    // The element the entry belongs to. Entries are keyed by address, and
+    // an element may die without a release: an expired (or different)
+    // owner marks the entry stale, and it is dropped on sight.
+    Hyprutils::Memory::CWeakPointer<Hyprtoolkit::IElement> self;
+};
+
+// Defaults when the element has no (live) entry
+const SLayoutItem& layoutItemOf(Hyprtoolkit::IElement* element);
+// The element's entry, created on first use
+SLayoutItem&       layoutItemFor(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& element);
+
+// Clamp a size to an element's min/max constraints
+Hyprutils::Math::Vector2D layoutConstrain(Hyprtoolkit::IElement* element, Hyprutils::Math::Vector2D size);
+
+// preferredSize / minimumSize through the element's measure cache
+std::optional<Hyprutils::Math::Vector2D> layoutPreferred(Hyprtoolkit::IElement* element, const Hyprutils::Math::Vector2D& constraints);
+std::optional<Hyprutils::Math::Vector2D> layoutMinimum(Hyprtoolkit::IElement* element, const Hyprutils::Math::Vector2D& constraints);
+
+// An element's size inputs changed (size, margin, grow, content): drop its
+// measurements and those of every ancestor (hyprtoolkit layouts included),
+// and relayout from the outermost affected container. Siblings keep their
+// caches.
+void layoutInvalidate(Hyprtoolkit::IElement* element);
+
+struct SLayoutStats {
+    uint64_t measured  = 0; // measure cache misses
+    uint64_t cacheHits = 0;
+    uint64_t relayouts = 0; // containers that placed their children
+    uint64_t skipped   = 0; // repositions skipped: same box, nothing dirty
+};
+
+extern SLayoutStats g_layoutStats;
+
+// Base of the native containers: owns the child list, the background
+// rectangle, its own size specs and the relayout-in-place machinery.
+// Subclasses measure content and place children.
+class CLayoutContainer : public Hyprtoolkit::IElement {
+  public:
+    ~CLayoutContainer() override;
+
+    void                                     paint() override;
+    void                                     reposition(const Hyprutils::Math::CBox& box, const Hyprutils::Math::Vector2D& maxSize = {-1, -1}) override;
+    std::optional<Hyprutils::Math::Vector2D> preferredSize(const Hyprutils::Math::Vector2D& parent) override;
+    std::optional<Hyprutils::Math::Vector2D> minimumSize(const Hyprutils::Math::Vector2D& parent) override;
+    std::optional<Hyprutils::Math::Vector2D> maximumSize(const Hyprutils::Math::Vector2D& parent) override;
+
+    void childAdded(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& child);
+    void childrenAdded(const std::vector<Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>>& children);
+    void childRemoved(Hyprtoolkit::IElement* child);
+    void childrenCleared();
+
+    // Inputs changed: drop cached measurements up the chain and lay out
+    // again on the next frame, starting from the outermost container whose
+    // size may depend on ours. Repeated calls before then coalesce.
+    void invalidate();
+
+    // The deferred pass requested by invalidate()
+    void relayout();
+
+    void setSize(jint width, jint height);
+    void setStyle(uint32_t background, uint32_t borderColor, int border, int rounding);
+    void setPadding(float padding);
+
+  protected:
+    // Content size within the padding, given the space inside the padding
+    virtual Hyprutils::Math::Vector2D contentSize(const Hyprutils::Math::Vector2D& inner)    = 0;
+    virtual Hyprutils::Math::Vector2D contentMinimum(const Hyprutils::Math::Vector2D& inner) = 0;
+
+    // Place children inside the padded box; dirty when inputs changed
+    virtual void layoutChildren(const Hyprutils::Math::CBox& inner, bool dirty) = 0;
+
+    // Reposition child i at box, remembered for passes that skip layout
+    void placeChild(size_t i, const Hyprutils::Math::CBox& box);
+
+    std::vector<Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>> m_children;
+    float                                                                 m_padding = 0;
+
+  private:
+    SSizeSpec                                                          m_width, m_height;
+    uint32_t                                                           m_background = 0, m_borderColor = 0;
+    int                                                                m_border = 0, m_rounding = 0;
+    Hyprutils::Memory::CSharedPointer<Hyprtoolkit::CRectangleElement> m_backgroundRect;
+
+    Hyprutils::Math::CBox                                              m_box;
+    Hyprutils::Math::Vector2D                                          m_maxSize = {-1, -1};
+    bool                                                               m_placed  = false;
+    bool                                                               m_dirty   = true;
+    Hyprutils::Math::CBox                                              m_lastInner;
+    std::vector<Hyprutils::Math::CBox>                                 m_placedBoxes; // last placement, per child
+
+    Hyprutils::Math::Vector2D resolveSize(const Hyprutils::Math::Vector2D& parent, const Hyprutils::Math::Vector2D& content) const;
+};
+
+// Every Element.addChild / removeChild / clearChildren goes through these
+// hooks: they keep the parent links invalidation walks up, and hand the
+// child list to native containers, which lay their children out
+// themselves. For other parents they invalidate the parent's measurements.
+void layoutChildAdded(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& parent,
+                      const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& child);
+// Many children added at once (bulk construction): one relayout for all
+void layoutChildrenAdded(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>&              parent,
+                         const std::vector<Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>>& children);
+void layoutChildRemoved(Hyprtoolkit::IElement* parent, Hyprtoolkit::IElement* child);
+void layoutChildrenCleared(Hyprtoolkit::IElement* parent);
+
+// Drop per-element layout state (release / recycle / destruction)
+void layoutForgetElement(Hyprtoolkit::IElement* element);
@@ -3,6 +3,8 @@
 #include <hyprtoolkit/element/RowLayout.hpp>
 #include <hyprutils/math/Vector2D.hpp>
 
+#include "hyprclj_layout.hpp"
+
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
 
@@ -17,13 +19,12 @@ Java_org_hyprclj_bindings_ColumnLayout_00024Builder_nativeCreate(
         auto builder = CColumnLayoutBuilder::begin();
         builder->gap(gap);
 
-        if (width > 0 && height > 0) {
-            builder->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      Vector2D{(double)width, (double)height}));
+        if (sizeSpecified(width, height)) {
+            builder->size(sizeFromSpec(width, height));
         }
 
         auto layout = builder->commence();
+        sizeNoteFill(layout, width, height);
         if (!layout) {
             return 0;
         }
@@ -43,13 +44,12 @@ Java_org_hyprclj_bindings_RowLayout_00024Builder_nativeCreate(
         auto builder = CRowLayoutBuilder::begin();
         builder->gap(gap);
 
-        if (width > 0 && height > 0) {
-            builder->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      Vector2D{(double)width, (double)height}));
+        if (sizeSpecified(width, height)) {
+            builder->size(sizeFromSpec(width, height));
         }
 
         auto layout = builder->commence();
+        sizeNoteFill(layout, width, height);
         if (!layout) {
             return 0;
         }
@@ -4,6 +4,9 @@
 #include <hyprutils/math/Vector2D.hpp>
 #include <vector>
 
+#include "hyprclj_layout.hpp"
+#include "hyprclj_palette.hpp"
+
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
 
@@ -20,11 +23,8 @@ Java_org_hyprclj_bindings_Line_00024Builder_nativeCreate(
     try {
         auto builder = CLineBuilder::begin();
 
-        // Set color
-        builder->color([r, g, b, a]() {
-            return CHyprColor{(float)r / 255.0f, (float)g / 255.0f,
-                             (float)b / 255.0f, (float)a / 255.0f};
-        });
+        // Set color (fixed, or read from a palette slot)
+        builder->color(paletteColor(r, g, b, a));
 
         // Set thickness
         builder->thick(thickness);
@@ -43,16 +43,16 @@ Java_org_hyprclj_bindings_Line_00024Builder_nativeCreate(
         builder->points(std::move(points));
 
         // Set size if specified
-        if (width > 0 && height > 0) {
-            builder->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      Vector2D{(double)width, (double)height}));
+        if (sizeSpecified(width, height)) {
+            builder->size(sizeFromSpec(width, height));
         }
 
         auto line = builder->commence();
+        sizeNoteFill(line, width, height);
         if (!line) {
             return 0;
         }
+        paletteBind(line, r);
 
         return reinterpret_cast<jlong>(new auto(line));
     } catch (const std::exception& e) {
@@ -0,0 +1,579 @@
+#include <jni.h>
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "hyprclj_mouse.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::Vector2D;
+
+extern JavaVM* g_jvm;
+extern JNIEnv* getEnv();
+
+// Mouse dispatch
+//
+// Each element gets one native dispatcher, installed as its hyprtoolkit
+// mouse callbacks on the first subscription. It holds a small table of
+// (event kinds, button mask, handler) entries and filters every event in
+// C++, so an element with several handlers keeps a single set of
+// callbacks and only crosses into Java for events someone subscribed to.
+// Double clicks are synthesized from two presses of the same button.
+//
+// Handlers are called with cached method IDs: Runnable for actions,
+// MouseHandler for primitive events (no allocation), and the legacy
+// Consumer<MouseEvent>, which still allocates its event object.
+//
+// Delegation: a container registers one DelegateHandler and its
+// descendants carry an integer tag instead of handlers of their own. An
+// event on a tagged element walks up the recorded parent links to the
+// nearest delegating ancestor and is reported there as (tag, event).
+// A tagged row costs a dispatcher slot and a parent link - no GlobalRef,
+// no Java object. Parent links are recorded by addChild for tagged
+// elements, their ancestors and everything added inside a delegating
+// container.
+//
+// All tables are keyed by element address and dropped on release. Each
+// entry also holds a weak pointer to its element: an entry whose owner has
+// expired or differs (an element destroyed without a release, and a new one
+// allocated at its address) is dropped with its GlobalRefs when looked up,
+// so the new element gets its own callbacks. The tables are swept once the
+// dispatcher table has doubled since the last sweep.
+namespace {
+
+constexpr int KIND_BUTTONS = (1 << MOUSE_PRESS) | (1 << MOUSE_RELEASE) | (1 << MOUSE_DOUBLE_CLICK);
+
+constexpr std::chrono::milliseconds DOUBLE_CLICK_TIME{400};
+constexpr double                    DOUBLE_CLICK_DISTANCE = 4.0;
+
+struct SMouseEntry {
+    int        id      = 0;
+    int        kinds   = 0; // 1 << eMouseKind
+    int        buttons = 0; // MOUSE_BUTTON_BIT_* mask, for button kinds
+    eMouseCall call    = MOUSE_CALL_RUNNABLE;
+    jobject    handler = nullptr;
+};
+
+// Entries installed by the legacy "set" entry points, which replace
+// rather than add
+enum eLegacySlot : int {
+    LEGACY_CLICK = 0,
+    LEGACY_ENTER,
+    LEGACY_LEAVE,
+    LEGACY_COUNT,
+};
+
+struct SMouseDispatcher {
+    Hyprutils::Memory::CWeakPointer<IElement> self;
+    std::vector<SMouseEntry>                  entries;
+    int                                       kinds = 0; // union of the entries' kinds
+    int                                       legacy[LEGACY_COUNT] = {}; // entry ids, 0 = none
+    bool                                      tagged = false;
+    int                                       tag    = 0;
+
+    Vector2D                                  pos; // last position seen by enter/move
+    std::function<void(const Vector2D&)>      onPointer; // native observer, see mouseTrackPointer
+    int                                       lastButton = 0;
+    Vector2D                                  lastPressPos;
+    std::chrono::steady_clock::time_point     lastPressTime;
+};
+
+struct SDelegate {
+    Hyprutils::Memory::CWeakPointer<IElement> self;
+    int                                       kinds   = 0;
+    int                                       buttons = 0;
+    jobject                                   handler = nullptr; // Element$DelegateHandler
+};
+
+struct STagLink {
+    Hyprutils::Memory::CWeakPointer<IElement> self;
+    Hyprutils::Memory::CWeakPointer<IElement> parent;
+};
+
+std::unordered_map<IElement*, SMouseDispatcher> g_dispatchers;
+std::unordered_map<IElement*, SDelegate>        g_delegates;
+size_t                                          g_sweepAt = 1024;
+
+// child -> parent, for elements on a path from a tagged element up to a
+// delegating container
+std::unordered_map<IElement*, STagLink> g_tagParents;
+// elements that are tagged or have a linked child
+std::unordered_map<IElement*, Hyprutils::Memory::CWeakPointer<IElement>> g_tagHolders;
+
+constexpr int MAX_DELEGATION_DEPTH = 64;
+
+jclass    g_mouseEventClass = nullptr; // global ref
+jmethodID g_mouseEventInit  = nullptr; // Element$MouseEvent.<init>(DDI)V
+jmethodID g_acceptMethod    = nullptr; // Consumer.accept(Ljava/lang/Object;)V
+jmethodID g_onMouseMethod   = nullptr; // Element$MouseHandler.onMouse(DDII)V
+jmethodID g_runMethod       = nullptr; // Runnable.run()V
+jmethodID g_onDelegateMethod = nullptr; // Element$DelegateHandler.onEvent(IIIDD)V
+int       g_nextEntryId     = 1;
+
+void cacheMethods(JNIEnv* env) {
+    if (g_onMouseMethod) return;
+
+    jclass eventClass    = env->FindClass("org/hyprclj/bindings/Element$MouseEvent");
+    g_mouseEventClass    = (jclass)env->NewGlobalRef(eventClass);
+    g_mouseEventInit     = env->GetMethodID(eventClass, "<init>", "(DDI)V");
+    jclass consumerClass = env->FindClass("java/util/function/Consumer");
+    g_acceptMethod       = env->GetMethodID(consumerClass, "accept", "(Ljava/lang/Object;)V");
+    jclass handlerClass  = env->FindClass("org/hyprclj/bindings/Element$MouseHandler");
+    g_onMouseMethod      = env->GetMethodID(handlerClass, "onMouse", "(DDII)V");
+    jclass runnableClass = env->FindClass("java/lang/Runnable");
+    g_runMethod          = env->GetMethodID(runnableClass, "run", "()V");
+    jclass delegateClass = env->FindClass("org/hyprclj/bindings/Element$DelegateHandler");
+    g_onDelegateMethod   = env->GetMethodID(delegateClass, "onEvent", "(IIIDD)V");
+}
+
+void clearException(JNIEnv* env) {
+    if (env->ExceptionCheck()) {
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+}
+
+int buttonBit(Input::eMouseButton button) {
+    switch (button) {
+        case Input::MOUSE_BUTTON_LEFT: return MOUSE_BUTTON_BIT_LEFT;
+        case Input::MOUSE_BUTTON_RIGHT: return MOUSE_BUTTON_BIT_RIGHT;
+        case Input::MOUSE_BUTTON_MIDDLE: return MOUSE_BUTTON_BIT_MIDDLE;
+        default: return MOUSE_BUTTON_BIT_OTHER;
+    }
+}
+
+void call(JNIEnv* env, const SMouseEntry& entry, eMouseKind kind, const Vector2D& pos, jint button) {
+    switch (entry.call) {
+        case MOUSE_CALL_RUNNABLE: env->CallVoidMethod(entry.handler, g_runMethod); break;
+        case MOUSE_CALL_HANDLER:
+            env->CallVoidMethod(entry.handler, g_onMouseMethod, pos.x, pos.y, button, (jint)kind);
+            break;
+        case MOUSE_CALL_CONSUMER: {
+            jobject event = env->NewObject(g_mouseEventClass, g_mouseEventInit, pos.x, pos.y, button);
+            env->CallVoidMethod(entry.handler, g_acceptMethod, event);
+            env->DeleteLocalRef(event);
+            break;
+        }
+    }
+
+    clearException(env);
+}
+
+void clearEntries(JNIEnv* env, SMouseDispatcher& d) {
+    for (auto& entry : d.entries) {
+        env->DeleteGlobalRef(entry.handler);
+    }
+    d.entries.clear();
+    d.kinds = 0;
+    std::ranges::fill(d.legacy, 0);
+}
+
+void removeEntry(JNIEnv* env, SMouseDispatcher& d, int id) {
+    d.kinds = 0;
+    std::erase_if(d.entries, [env, id](const SMouseEntry& entry) {
+        if (entry.id != id) return false;
+        env->DeleteGlobalRef(entry.handler);
+        return true;
+    });
+    for (const auto& entry : d.entries) {
+        d.kinds |= entry.kinds;
+    }
+}
+
+// The live dispatcher of an element, or nullptr. An entry left by a dead
+// element at the same address is dropped with its handlers
+SMouseDispatcher* findDispatcher(IElement* element) {
+    auto it = g_dispatchers.find(element);
+    if (it == g_dispatchers.end()) return nullptr;
+
+    if (it->second.self.get() != element) {
+        clearEntries(getEnv(), it->second);
+        g_dispatchers.erase(it);
+        return nullptr;
+    }
+    return &it->second;
+}
+
+SDelegate* findDelegate(IElement* element) {
+    auto it = g_delegates.find(element);
+    if (it == g_delegates.end()) return nullptr;
+
+    if (it->second.self.get() != element) {
+        getEnv()->DeleteGlobalRef(it->second.handler);
+        g_delegates.erase(it);
+        return nullptr;
+    }
+    return &it->second;
+}
+
+STagLink* findTagLink(IElement* element) {
+    auto it = g_tagParents.find(element);
+    if (it == g_tagParents.end()) return nullptr;
+
+    if (it->second.self.get() != element) {
+        g_tagParents.erase(it);
+        return nullptr;
+    }
+    return &it->second;
+}
+
+bool isTagHolder(IElement* element) {
+    auto it = g_tagHolders.find(element);
+    if (it == g_tagHolders.end()) return false;
+
+    if (it->second.get() != element) {
+        g_tagHolders.erase(it);
+        return false;
+    }
+    return true;
+}
+
+void sweepStale() {
+    JNIEnv* env = getEnv();
+    for (auto it = g_dispatchers.begin(); it != g_dispatchers.end();) {
+        if (it->second.self.get() == it->first) {
+            ++it;
+            continue;
+        }
+        clearEntries(env, it->second);
+        it = g_dispatchers.erase(it);
+    }
+    std::erase_if(g_delegates, [env](const auto& entry) {
+        if (entry.second.self.get() == entry.first) return false;
+        env->DeleteGlobalRef(entry.second.handler);
+        return true;
+    });
+    std::erase_if(g_tagParents, [](const auto& entry) { return entry.second.self.get() != entry.first; });
+    std::erase_if(g_tagHolders, [](const auto& entry) { return entry.second.get() != entry.first; });
+    g_sweepAt = std::max<size_t>(1024, g_dispatchers.size() * 2);
+}
+
+bool stillRegistered(IElement* element, int id) {
+    auto* d = findDispatcher(element);
+    if (!d) return false;
+    return std::ranges::any_of(d->entries, [id](const SMouseEntry& entry) { return entry.id == id; });
+}
+
+// Nearest delegating ancestor of element subscribed to this event
+SDelegate* delegateFor(IElement* element, eMouseKind kind, int buttonMask) {
+    IElement* current = element;
+    for (int depth = 0; depth < MAX_DELEGATION_DEPTH; ++depth) {
+        auto* link = findTagLink(current);
+        if (!link) return nullptr;
+
+        auto parent = link->parent.lock();
+        if (!parent) return nullptr;
+        current = parent.get();
+
+        auto* delegate = findDelegate(current);
+        if (!delegate) continue;
+
+        if (!(delegate->kinds & (1 << kind)) || (buttonMask && !(delegate->buttons & buttonMask))) return nullptr;
+        return delegate;
+    }
+    return nullptr;
+}
+
+void dispatch(IElement* element, eMouseKind kind, int buttonMask, jint button) {
+    auto* found = findDispatcher(element);
+    if (!found) return;
+
+    const auto& d      = *found;
+    const bool  own    = d.kinds & (1 << kind);
+    const bool  tagged = d.tagged;
+    const int   tag    = d.tag;
+    if (!own && !tagged) return;
+
+    // Handlers may add or remove entries (or release the element): call a
+    // snapshot of the matching ones, skipping any removed meanwhile
+    const Vector2D           pos = d.pos;
+    std::vector<SMouseEntry> matched;
+    if (own) {
+        for (const auto& entry : d.entries) {
+            if ((entry.kinds & (1 << kind)) && (!buttonMask || (entry.buttons & buttonMask))) {
+                matched.push_back(entry);
+            }
+        }
+    }
+
+    JNIEnv* env = nullptr;
+    for (size_t i = 0; i < matched.size(); ++i) {
+        if (i > 0 && !stillRegistered(element, matched[i].id)) continue;
+        env = env ? env : getEnv();
+        call(env, matched[i], kind, pos, button);
+    }
+
+    if (!tagged || (!matched.empty() && !g_dispatchers.contains(element))) return;
+
+    auto* delegate = delegateFor(element, kind, buttonMask);
+    if (!delegate) return;
+
+    env = env ? env : getEnv();
+    env->CallVoidMethod(delegate->handler, g_onDelegateMethod, (jint)tag, (jint)kind, button, pos.x,
+                        pos.y);
+    clearException(env);
+}
+
+void onButton(IElement* element, Input::eMouseButton button, bool pressed) {
+    auto* found = findDispatcher(element);
+    if (!found) return;
+    auto& d = *found;
+
+    const int bit = buttonBit(button);
+    if (!pressed) {
+        dispatch(element, MOUSE_RELEASE, bit, (jint)button);
+        return;
+    }
+
+    // A second press of the same button, close in time and space
+    const auto now         = std::chrono::steady_clock::now();
+    const bool doubleClick = d.lastButton == bit && now - d.lastPressTime <= DOUBLE_CLICK_TIME &&
+        d.pos.distance(d.lastPressPos) <= DOUBLE_CLICK_DISTANCE;
+
+    // A triple click is a double click followed by a fresh first press
+    d.lastButton    = doubleClick ? 0 : bit;
+    d.lastPressTime = now;
+    d.lastPressPos  = d.pos;
+
+    dispatch(element, MOUSE_PRESS, bit, (jint)button);
+    if (doubleClick) {
+        dispatch(element, MOUSE_DOUBLE_CLICK, bit, (jint)button);
+    }
+}
+
+// Dispatcher for an element, installing its mouse callbacks on first use
+SMouseDispatcher& dispatcherFor(const Hyprutils::Memory::CSharedPointer<IElement>& owner) {
+    IElement* element = owner.get();
+    if (auto* d = findDispatcher(element)) return *d;
+    if (g_dispatchers.size() >= g_sweepAt) sweepStale();
+
+    auto& d = g_dispatchers[element];
+    d.self  = owner;
+
+    element->setReceivesMouse(true);
+    element->setMouseButton([element](Input::eMouseButton button, bool pressed) {
+        onButton(element, button, pressed);
+    });
+    element->setMouseEnter([element](const Vector2D& pos) {
+        auto* d = findDispatcher(element);
+        if (!d) return;
+        d->pos = pos;
+        if (d->onPointer) {
+            d->onPointer(pos);
+        }
+        dispatch(element, MOUSE_ENTER, 0, 0);
+    });
+    element->setMouseLeave([element]() {
+        dispatch(element, MOUSE_LEAVE, 0, 0);
+    });
+    // Always tracked so button events carry the pointer position; only
+    // calls into Java when a handler subscribed to moves
+    element->setMouseMove([element](const Vector2D& pos) {
+        auto* d = findDispatcher(element);
+        if (!d) return;
+        d->pos = pos;
+        if (d->onPointer) {
+            d->onPointer(pos);
+        }
+        dispatch(element, MOUSE_MOVE, 0, 0);
+    });
+    return d;
+}
+
+Hyprutils::Memory::CSharedPointer<IElement> elementFor(jlong handle) {
+    return *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+}
+
+void tagElement(const Hyprutils::Memory::CSharedPointer<IElement>& element, int tag) {
+    auto& d  = dispatcherFor(element);
+    d.tagged = true;
+    d.tag    = tag;
+    g_tagHolders[element.get()] = element;
+}
+
+void linkParent(const Hyprutils::Memory::CSharedPointer<IElement>& parent,
+                const Hyprutils::Memory::CSharedPointer<IElement>& child) {
+    g_tagParents[child.get()]  = STagLink{child, parent};
+    g_tagHolders[parent.get()] = parent;
+}
+
+// setMouseClick / Enter / Leave: replace the slot's previous entry, so
+// calling them on every render doesn't stack handlers
+void setLegacy(JNIEnv* env, const Hyprutils::Memory::CSharedPointer<IElement>& element, eLegacySlot slot, int kinds,
+               int buttons, jobject callback) {
+    if (!element) return;
+
+    if (auto* d = findDispatcher(element.get()); d && d->legacy[slot]) {
+        removeEntry(env, *d, d->legacy[slot]);
+        d->legacy[slot] = 0;
+    }
+
+    const int id = mouseAddHandler(env, element, kinds, buttons, MOUSE_CALL_CONSUMER, callback);
+    if (id) {
+        dispatcherFor(element).legacy[slot] = id;
+    }
+}
+
+} // namespace
+
+int mouseAddHandler(JNIEnv* env, const Hyprutils::Memory::CSharedPointer<IElement>& element, int kinds, int buttons, eMouseCall call, jobject handler) {
+    if (!element || !handler || !kinds) return 0;
+    cacheMethods(env);
+
+    auto& d = dispatcherFor(element);
+    SMouseEntry entry{g_nextEntryId++, kinds, buttons, call, env->NewGlobalRef(handler)};
+    d.entries.push_back(entry);
+    d.kinds |= kinds;
+    return entry.id;
+}
+
+void mouseForgetElement(IElement* element) {
+    g_tagParents.erase(element);
+    g_tagHolders.erase(element);
+
+    if (auto it = g_delegates.find(element); it != g_delegates.end()) {
+        getEnv()->DeleteGlobalRef(it->second.handler);
+        g_delegates.erase(it);
+    }
+
+    auto it = g_dispatchers.find(element);
+    if (it == g_dispatchers.end()) return;
+
+    clearEntries(getEnv(), it->second);
+    g_dispatchers.erase(it);
+}
+
+void mouseTrackPointer(const Hyprutils::Memory::CSharedPointer<IElement>& element, std::function<void(const Vector2D&)> onPointer) {
+    if (!element) return;
+    dispatcherFor(element).onPointer = std::move(onPointer);
+}
+
+void mouseChildAdded(const Hyprutils::Memory::CSharedPointer<IElement>& parent,
+                     const Hyprutils::Memory::CSharedPointer<IElement>& child) {
+    // Nothing delegated anywhere (the common case): no bookkeeping
+    if (g_delegates.empty() && g_tagHolders.empty()) return;
+
+    IElement* p = parent.get();
+    if (isTagHolder(child.get()) || findDelegate(p) || findTagLink(p)) {
+        linkParent(parent, child);
+    }
+}
+
+void mouseChildRemoved(IElement* parent, IElement* child) {
+    auto* link = findTagLink(child);
+    if (link && link->parent.get() == parent) {
+        g_tagParents.erase(child);
+    }
+}
+
+extern "C" {
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Element_nativeAddMouseListener(
+    JNIEnv* env, jobject obj, jlong handle, jint kinds, jint buttons, jobject handler) {
+
+    return mouseAddHandler(env, elementFor(handle), kinds, buttons, MOUSE_CALL_HANDLER, handler);
+}
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Element_nativeAddMouseAction(
+    JNIEnv* env, jobject obj, jlong handle, jint kinds, jint buttons, jobject action) {
+
+    return mouseAddHandler(env, elementFor(handle), kinds, buttons, MOUSE_CALL_RUNNABLE, action);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeRemoveMouseListener(
+    JNIEnv* env, jobject obj, jlong handle, jint id) {
+
+    auto* d = findDispatcher(elementFor(handle).get());
+    if (!d) return;
+    removeEntry(env, *d, id);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetDelegateHandler(
+    JNIEnv* env, jobject obj, jlong handle, jint kinds, jint buttons, jobject handler) {
+
+    auto element = elementFor(handle);
+    if (!element) return;
+    cacheMethods(env);
+
+    if (auto* delegate = findDelegate(element.get())) {
+        env->DeleteGlobalRef(delegate->handler);
+        g_delegates.erase(element.get());
+    }
+    if (handler && kinds) {
+        g_delegates[element.get()] = SDelegate{element, kinds, buttons, env->NewGlobalRef(handler)};
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetEventTag(
+    JNIEnv* env, jobject obj, jlong handle, jint tag) {
+
+    auto element = elementFor(handle);
+    if (!element) return;
+    cacheMethods(env);
+    tagElement(element, tag);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeTagChild(
+    JNIEnv* env, jobject obj, jlong handle, jlong childHandle, jint tag) {
+
+    auto container = elementFor(handle);
+    auto child     = elementFor(childHandle);
+    if (!container || !child) return;
+    cacheMethods(env);
+
+    // Explicit link: works wherever the child sits below the container
+    tagElement(child, tag);
+    linkParent(container, child);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetMouseClick(
+    JNIEnv* env, jobject obj, jlong handle, jobject callback) {
+
+    setLegacy(env, elementFor(handle), LEGACY_CLICK, 1 << MOUSE_PRESS, MOUSE_BUTTON_BIT_ANY, callback);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetMouseEnter(
+    JNIEnv* env, jobject obj, jlong handle, jobject callback) {
+
+    setLegacy(env, elementFor(handle), LEGACY_ENTER, 1 << MOUSE_ENTER, 0, callback);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetMouseLeave(
+    JNIEnv* env, jobject obj, jlong handle, jobject callback) {
+
+    setLegacy(env, elementFor(handle), LEGACY_LEAVE, 1 << MOUSE_LEAVE, 0, callback);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeSetMouseHandler(
+    JNIEnv* env, jobject obj, jlong handle, jobject handler, jboolean withMove) {
+
+    auto element = elementFor(handle);
+    if (!element || !handler) return;
+
+    // Replaces every handler registered on the element
+    if (auto* d = findDispatcher(element.get())) {
+        clearEntries(env, *d);
+    }
+
+    int kinds = KIND_BUTTONS | (1 << MOUSE_ENTER) | (1 << MOUSE_LEAVE);
+    if (withMove) {
+        kinds |= 1 << MOUSE_MOVE;
+    }
+    mouseAddHandler(env, element, kinds, MOUSE_BUTTON_BIT_ANY, MOUSE_CALL_HANDLER, handler);
+}
+
+} // extern "C"
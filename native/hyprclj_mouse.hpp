@@ -0,0 +1,51 @@
+#pragma once
+
+#include <jni.h>
+#include <hyprtoolkit/element/Element.hpp>
+#include <functional>
+
+// Per-element mouse dispatch (hyprclj_mouse.cpp)
+//
+// Handlers subscribe to a set of event kinds and a button mask; events are
+// filtered natively and only matching handlers are called. Tagged elements
+// report their events to the nearest delegating ancestor instead.
+
+// Keep in sync with Element.MOUSE_*
+enum eMouseKind : int {
+    MOUSE_PRESS = 0,
+    MOUSE_RELEASE,
+    MOUSE_ENTER,
+    MOUSE_LEAVE,
+    MOUSE_MOVE,
+    MOUSE_DOUBLE_CLICK,
+};
+
+// Keep in sync with Element.BUTTON_*
+constexpr int MOUSE_BUTTON_BIT_LEFT   = 1 << 0;
+constexpr int MOUSE_BUTTON_BIT_RIGHT  = 1 << 1;
+constexpr int MOUSE_BUTTON_BIT_MIDDLE = 1 << 2;
+constexpr int MOUSE_BUTTON_BIT_OTHER  = 1 << 3;
+constexpr int MOUSE_BUTTON_BIT_ANY    = 0xF;
+
+enum eMouseCall : int {
+    MOUSE_CALL_RUNNABLE = 0, // Runnable.run()
+    MOUSE_CALL_HANDLER,      // Element$MouseHandler.onMouse(DDII)V
+    MOUSE_CALL_CONSUMER,     // Consumer<Element$MouseEvent>.accept
+};
+
+// Subscribe handler to kinds (1 << eMouseKind mask) for the given buttons;
+// returns the subscription id, or 0
+int  mouseAddHandler(JNIEnv* env, const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& element, int kinds,
+                     int buttons, eMouseCall call, jobject handler);
+
+// Drop an element's dispatcher, handlers and delegation state (release / recycle)
+void mouseForgetElement(Hyprtoolkit::IElement* element);
+
+// Observe pointer enter/move positions natively, without a Java handler
+void mouseTrackPointer(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& element,
+                       std::function<void(const Hyprutils::Math::Vector2D&)> onPointer);
+
+// Keep the parent links used by event delegation (Element.addChild / removeChild)
+void mouseChildAdded(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& parent,
+                     const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& child);
+void mouseChildRemoved(Hyprtoolkit::IElement* parent, Hyprtoolkit::IElement* child);
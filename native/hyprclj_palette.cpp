@@ -0,0 +1,238 @@
+#include <jni.h>
+#include <hyprtoolkit/core/Backend.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "hyprclj_palette.hpp"
+#include "hyprclj_timers.hpp"
+
+using namespace Hyprtoolkit;
+
+// Palette
+//
+// Slots live in one table indexed by slot id and are never freed: a theme has
+// a handful of them for the life of the app. Each slot keeps its bound
+// elements as weak pointers keyed by address, with the roles (fill, border)
+// they are bound in; dead ones are dropped the next time the slot repaints.
+// Binding a role first unbinds it from every slot, which is cheap with a
+// handful of slots, so a recolored or recycled element stays bound to one
+// slot per role.
+//
+// Animations interpolate in straight RGBA, linearly, driven by a single
+// timer on the timing wheel (hyprclj_timers.cpp) at the frame interval
+// that only runs while a slot animates.
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct SBinding {
+    Hyprutils::Memory::CWeakPointer<IElement> element;
+    PaletteRepaintFn                          repaint = nullptr;
+    uint8_t                                   roles   = 0; // 1 << ePaletteRole
+};
+
+struct SSlot {
+    uint32_t                                rgba = 0;
+    CHyprColor                              color;
+
+    bool                                    animating = false;
+    uint32_t                                from = 0, to = 0;
+    Clock::time_point                       start;
+    std::chrono::milliseconds               duration{0};
+
+    std::unordered_map<IElement*, SBinding> bindings;
+};
+
+struct SPalette {
+    std::vector<SSlot>                          slots;
+    Hyprutils::Memory::CSharedPointer<IBackend> backend;
+    bool                                        ticking = false;
+    uint64_t                                    repaints = 0;
+};
+
+SPalette                        g_palette;
+constexpr std::chrono::milliseconds FRAME{16};
+
+CHyprColor unpack(uint32_t rgba) {
+    return CHyprColor{(float)((rgba >> 24) & 0xFF) / 255.0f, (float)((rgba >> 16) & 0xFF) / 255.0f,
+                      (float)((rgba >> 8) & 0xFF) / 255.0f, (float)(rgba & 0xFF) / 255.0f};
+}
+
+uint32_t lerp(uint32_t from, uint32_t to, double t) {
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        const double a = (from >> shift) & 0xFF, b = (to >> shift) & 0xFF;
+        out |= (uint32_t)std::clamp((int)std::lround(a + (b - a) * t), 0, 255) << shift;
+    }
+    return out;
+}
+
+SSlot* slotFor(jint slot) {
+    if (slot < 0 || (size_t)slot >= g_palette.slots.size()) return nullptr;
+    return &g_palette.slots[slot];
+}
+
+void store(SSlot& slot, uint32_t rgba) {
+    slot.rgba  = rgba;
+    slot.color = unpack(rgba);
+}
+
+void repaint(SSlot& slot) {
+    for (auto it = slot.bindings.begin(); it != slot.bindings.end();) {
+        auto element = it->second.element.lock();
+        if (!element) {
+            it = slot.bindings.erase(it);
+            continue;
+        }
+        it->second.repaint(element.get());
+        g_palette.repaints++;
+        ++it;
+    }
+}
+
+void unbind(IElement* element, uint8_t roles) {
+    for (auto& slot : g_palette.slots) {
+        auto it = slot.bindings.find(element);
+        if (it == slot.bindings.end()) continue;
+
+        it->second.roles &= ~roles;
+        if (!it->second.roles) {
+            slot.bindings.erase(it);
+        }
+    }
+}
+
+void tick() {
+    auto&      p   = g_palette;
+    const auto now = Clock::now();
+    bool       more = false;
+
+    for (auto& slot : p.slots) {
+        if (!slot.animating) continue;
+
+        const double t = slot.duration.count() > 0 ?
+            std::min(1.0, std::chrono::duration<double, std::milli>(now - slot.start).count() / slot.duration.count()) :
+            1.0;
+        const uint32_t rgba = lerp(slot.from, slot.to, t);
+        slot.animating      = t < 1.0;
+        more |= slot.animating;
+
+        if (rgba != slot.rgba) {
+            store(slot, rgba);
+            repaint(slot);
+        }
+    }
+
+    p.ticking = more && p.backend;
+    if (p.ticking) {
+        timerAdd(p.backend, (uint32_t)FRAME.count(), 0, [] { tick(); });
+    }
+}
+
+} // namespace
+
+std::function<CHyprColor()> paletteColor(jint r, jint g, jint b, jint a) {
+    if (r < 0) {
+        const jint slot = -r - 1;
+        return [slot]() {
+            const SSlot* s = slotFor(slot);
+            return s ? s->color : CHyprColor{0, 0, 0, 0};
+        };
+    }
+    return [r, g, b, a]() { return CHyprColor{(float)r / 255.0f, (float)g / 255.0f, (float)b / 255.0f, (float)a / 255.0f}; };
+}
+
+void paletteBind(const Hyprutils::Memory::CSharedPointer<IElement>& element, jint r, ePaletteRole role,
+                 PaletteRepaintFn repaint) {
+    if (!element) return;
+
+    const uint8_t bit = 1 << role;
+    unbind(element.get(), bit);
+    if (r >= 0) return;
+
+    SSlot* slot = slotFor(-r - 1);
+    if (!slot) return;
+
+    // An entry left by a dead element at the same address starts over
+    auto& binding = slot->bindings[element.get()];
+    if (binding.element.lock() != element) {
+        binding = SBinding{element, repaint, 0};
+    }
+    binding.repaint = repaint;
+    binding.roles |= bit;
+}
+
+void paletteUnbind(IElement* element) {
+    unbind(element, 0xFF);
+}
+
+extern "C" {
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Palette_nativeCreate(JNIEnv* env, jclass clazz, jint rgba) {
+    SSlot slot;
+    store(slot, (uint32_t)rgba);
+    g_palette.slots.push_back(std::move(slot));
+    return (jint)g_palette.slots.size() - 1;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Palette_nativeSet(JNIEnv* env, jclass clazz, jint slotId, jint rgba) {
+    SSlot* slot = slotFor(slotId);
+    if (!slot) return;
+
+    slot->animating = false;
+    if ((uint32_t)rgba == slot->rgba) return;
+    store(*slot, (uint32_t)rgba);
+    repaint(*slot);
+}
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Palette_nativeGet(JNIEnv* env, jclass clazz, jint slotId) {
+    const SSlot* slot = slotFor(slotId);
+    return slot ? (jint)slot->rgba : 0;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Palette_nativeAnimate(
+    JNIEnv* env, jclass clazz, jlong backendHandle, jint slotId, jint rgba, jint durationMs) {
+
+    SSlot* slot = slotFor(slotId);
+    if (!slot) return;
+
+    auto& p = g_palette;
+    if (!p.backend && backendHandle) {
+        p.backend = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(backendHandle);
+    }
+
+    // Retargeting a running animation starts from where it is now
+    slot->animating = true;
+    slot->from      = slot->rgba;
+    slot->to        = (uint32_t)rgba;
+    slot->start     = Clock::now();
+    slot->duration  = std::chrono::milliseconds(std::max(durationMs, 0));
+    if (!p.backend) {
+        slot->duration = std::chrono::milliseconds(0);
+    }
+
+    if (!p.ticking) {
+        tick();
+    }
+}
+
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Palette_nativeStats(JNIEnv* env, jclass clazz) {
+    const auto& p        = g_palette;
+    jlong       bindings = 0;
+    for (const auto& slot : p.slots) bindings += (jlong)slot.bindings.size();
+
+    const jlong values[3] = {(jlong)p.slots.size(), bindings, (jlong)p.repaints};
+    jlongArray  result    = env->NewLongArray(3);
+    env->SetLongArrayRegion(result, 0, 3, values);
+    return result;
+}
+
+} // extern "C"
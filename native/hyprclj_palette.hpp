@@ -0,0 +1,44 @@
+#pragma once
+
+#include <jni.h>
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprtoolkit/palette/Color.hpp>
+#include <cstdint>
+#include <functional>
+
+// Palette (hyprclj_palette.cpp)
+//
+// Shared color slots. Builders and color setters take a color as r, g, b, a;
+// a negative r refers to palette slot -r - 1 instead (Palette.ref on the Java
+// side). The element then gets a provider reading the slot at paint time and
+// is bound to the slot, so setting or animating the slot repaints every bound
+// element without rebuilding it with a new color.
+
+// Which color of an element a binding drives; an element is bound to at
+// most one slot per role
+enum ePaletteRole : uint8_t {
+    PALETTE_COLOR = 0,
+    PALETTE_BORDER,
+};
+
+// Repaints a bound element of a known type. A plain function pointer, so a
+// binding costs no allocation.
+using PaletteRepaintFn = void (*)(Hyprtoolkit::IElement*);
+
+// Color provider for a JNI color: a fixed color, or the slot r refers to
+std::function<Hyprtoolkit::CHyprColor()> paletteColor(jint r, jint g, jint b, jint a);
+
+// Bind an element's color in role to the slot r refers to, replacing the
+// slot it was bound to before; a plain color just unbinds
+void paletteBind(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IElement>& element, jint r, ePaletteRole role,
+                 PaletteRepaintFn repaint);
+
+template <class T>
+void paletteBind(const Hyprutils::Memory::CSharedPointer<T>& element, jint r, ePaletteRole role = PALETTE_COLOR) {
+    // Re-committing the unchanged builder is the only way to damage an
+    // element; the color provider is read again on the repaint
+    paletteBind(element, r, role, [](Hyprtoolkit::IElement* e) { static_cast<T*>(e)->rebuild()->commence(); });
+}
+
+// Drop all of an element's bindings (released or parked in a pool)
+void paletteUnbind(Hyprtoolkit::IElement* element);
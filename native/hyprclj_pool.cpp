@@ -0,0 +1,136 @@
+#include <jni.h>
+#include <hyprtoolkit/element/Element.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "hyprclj_layout.hpp"
+#include "hyprclj_mouse.hpp"
+#include "hyprclj_palette.hpp"
+#include "hyprclj_pool.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::Vector2D;
+
+// Key handlers registered for an element (hyprclj_input.cpp)
+extern void inputForgetElement(IElement* element);
+// Text model and callbacks of a textbox (hyprclj_textbox.cpp)
+extern void textboxForgetElement(IElement* element);
+
+namespace {
+
+// Parked elements per key beyond this are destroyed instead
+constexpr size_t POOL_CAPACITY = 256;
+
+struct SPool {
+    std::vector<jlong> parked;
+};
+
+struct SPoolStats {
+    uint64_t hits   = 0;
+    uint64_t misses = 0;
+};
+
+std::unordered_map<uint32_t, SPool> g_pools;
+std::unordered_map<jlong, uint32_t> g_poolKeys; // handle -> pool key
+SPoolStats                          g_poolStats[POOL_TYPE_COUNT];
+
+// Return a parked element to a neutral state: no children, no callbacks,
+// default positioning. Type-specific options are reset by rebuild() on reuse.
+void resetElement(const Hyprutils::Memory::CSharedPointer<IElement>& element) {
+    inputForgetElement(element.get());
+    textboxForgetElement(element.get());
+    mouseForgetElement(element.get());
+    layoutForgetElement(element.get());
+    paletteUnbind(element.get());
+    element->clearChildren();
+    element->setMouseButton([](Input::eMouseButton, bool) {});
+    element->setMouseEnter([](const Vector2D&) {});
+    element->setMouseLeave([]() {});
+    element->setMouseMove([](const Vector2D&) {});
+    element->setPositionMode(IElement::HT_POSITION_AUTO);
+    element->setPositionFlag(IElement::HT_POSITION_FLAG_CENTER, false);
+    element->setPositionFlag(IElement::HT_POSITION_FLAG_LEFT, false);
+    element->setPositionFlag(IElement::HT_POSITION_FLAG_RIGHT, false);
+    element->setPositionFlag(IElement::HT_POSITION_FLAG_TOP, false);
+    element->setPositionFlag(IElement::HT_POSITION_FLAG_BOTTOM, false);
+    element->setAbsolutePosition(Vector2D{0, 0});
+    element->setMargin(0);
+    element->setGrow(false);
+}
+
+} // namespace
+
+jlong poolAcquire(uint32_t key) {
+    auto& stats = g_poolStats[key >> 8];
+    auto  it    = g_pools.find(key);
+
+    if (it == g_pools.end() || it->second.parked.empty()) {
+        stats.misses++;
+        return 0;
+    }
+
+    stats.hits++;
+    jlong handle = it->second.parked.back();
+    it->second.parked.pop_back();
+    return handle;
+}
+
+void poolTrack(jlong handle, uint32_t key) {
+    g_poolKeys[handle] = key;
+}
+
+void poolRelease(jlong handle) {
+    auto* ptr = reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    if (!ptr) return;
+
+    auto key = g_poolKeys.find(handle);
+    if (key != g_poolKeys.end() && *ptr) {
+        auto& pool = g_pools[key->second];
+        if (pool.parked.size() < POOL_CAPACITY) {
+            resetElement(*ptr);
+            pool.parked.push_back(handle);
+            return;
+        }
+        g_poolKeys.erase(key);
+    }
+
+    // Not poolable (or pool full): drop our reference
+    if (*ptr) {
+        inputForgetElement(ptr->get());
+        textboxForgetElement(ptr->get());
+        mouseForgetElement(ptr->get());
+        layoutForgetElement(ptr->get());
+        paletteUnbind(ptr->get());
+    }
+    delete ptr;
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Element_nativeRelease(
+    JNIEnv* env, jobject obj, jlong handle) {
+
+    poolRelease(handle);
+}
+
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Element_nativePoolStats(JNIEnv* env, jclass clazz) {
+    // Per type: parked, hits, misses
+    jlong values[POOL_TYPE_COUNT * 3] = {};
+
+    for (const auto& [key, pool] : g_pools) {
+        values[(key >> 8) * 3] += (jlong)pool.parked.size();
+    }
+    for (uint32_t type = 0; type < POOL_TYPE_COUNT; ++type) {
+        values[type * 3 + 1] = (jlong)g_poolStats[type].hits;
+        values[type * 3 + 2] = (jlong)g_poolStats[type].misses;
+    }
+
+    jlongArray result = env->NewLongArray(POOL_TYPE_COUNT * 3);
+    env->SetLongArrayRegion(result, 0, POOL_TYPE_COUNT * 3, values);
+    return result;
+}
+
+} // extern "C"
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <jni.h>
+#include <cstdint>
+
+// Element recycling pools
+//
+// Released elements are reset and parked per pool key instead of being
+// destroyed; the create paths of pooled types reuse a parked element and
+// reconfigure it through rebuild(). A pool key is the element type plus the
+// builder options that rebuild() cannot undo (e.g. a fixed size), so a parked
+// element is only handed out to a create call with the same shape.
+
+enum ePoolType : uint32_t {
+    POOL_BUTTON = 0,
+    POOL_TEXT,
+    POOL_RECTANGLE,
+    POOL_TYPE_COUNT,
+};
+
+constexpr uint32_t poolKey(ePoolType type, uint32_t variant) {
+    return ((uint32_t)type << 8) | (variant & 0xFF);
+}
+
+// Take a parked element handle for this key, or 0 (counted as hit / miss)
+jlong poolAcquire(uint32_t key);
+
+// Remember the pool key of a freshly created element so release can park it
+void  poolTrack(jlong handle, uint32_t key);
+
+// Release an element handle as Element.release does: park it in its pool,
+// or forget its native state and drop the reference
+void  poolRelease(jlong handle);
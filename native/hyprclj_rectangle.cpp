@@ -2,62 +2,126 @@
 #include <hyprtoolkit/element/Rectangle.hpp>
 #include <hyprtoolkit/palette/Color.hpp>
 #include <hyprutils/math/Vector2D.hpp>
+#include <algorithm>
+#include <vector>
+
+#include "hyprclj_bulk.hpp"
+#include "hyprclj_layout.hpp"
+#include "hyprclj_palette.hpp"
+#include "hyprclj_pool.hpp"
 
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
 
-extern "C" {
-
-JNIEXPORT jlong JNICALL
-Java_org_hyprclj_bindings_Rectangle_00024Builder_nativeCreate(
-    JNIEnv* env, jclass clazz,
-    jint r, jint g, jint b, jint a,
-    jint borderR, jint borderG, jint borderB, jint borderA,
-    jint borderThickness, jint rounding,
-    jint width, jint height, jfloat alpha) {
+namespace {
 
+jlong createRectangle(jint r, jint g, jint b, jint a,
+                      jint borderR, jint borderG, jint borderB, jint borderA,
+                      jint borderThickness, jint rounding, jint width, jint height) {
     try {
-        auto builder = CRectangleBuilder::begin();
+        const bool hasSize = sizeSpecified(width, height);
+
+        // Reuse a parked rectangle of the same shape when there is one
+        const uint32_t key    = poolKey(POOL_RECTANGLE, hasSize ? 1 : 0);
+        const jlong    pooled = poolAcquire(key);
+        auto pooledRect = pooled ? *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CRectangleElement>*>(pooled) : nullptr;
+
+        auto builder = pooledRect ? pooledRect->rebuild() : CRectangleBuilder::begin();
 
-        // Set background color
-        builder->color([r, g, b, a]() {
-            return CHyprColor{(float)r / 255.0f, (float)g / 255.0f,
-                             (float)b / 255.0f, (float)a / 255.0f};
-        });
+        // Set background color (fixed, or read from a palette slot)
+        builder->color(paletteColor(r, g, b, a));
 
         // Set border color if thickness > 0
         if (borderThickness > 0) {
-            builder->borderColor([borderR, borderG, borderB, borderA]() {
-                return CHyprColor{(float)borderR / 255.0f, (float)borderG / 255.0f,
-                                 (float)borderB / 255.0f, (float)borderA / 255.0f};
-            });
+            builder->borderColor(paletteColor(borderR, borderG, borderB, borderA));
             builder->borderThickness(borderThickness);
+        } else if (pooled) {
+            builder->borderThickness(0);
         }
 
-        // Set rounding
-        if (rounding > 0) {
+        // Set rounding (a recycled rectangle may carry an old one)
+        if (rounding > 0 || pooled) {
             builder->rounding(rounding);
         }
 
         // Set size if specified
-        if (width > 0 && height > 0) {
-            builder->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      Vector2D{(double)width, (double)height}));
+        if (hasSize) {
+            builder->size(sizeFromSpec(width, height));
         }
 
         auto rect = builder->commence();
+        sizeNoteFill(rect, width, height);
+        if (pooled) {
+            paletteBind(pooledRect, r);
+            paletteBind(pooledRect, borderThickness > 0 ? borderR : 0, PALETTE_BORDER);
+            return pooled;
+        }
         if (!rect) {
             return 0;
         }
+        paletteBind(rect, r);
+        paletteBind(rect, borderThickness > 0 ? borderR : 0, PALETTE_BORDER);
 
         // Note: Rectangle doesn't have .a() method in Hyprtoolkit API
         // Alpha will be controlled via the color's alpha channel only
 
-        return reinterpret_cast<jlong>(new auto(rect));
+        jlong handle = reinterpret_cast<jlong>(new auto(rect));
+        poolTrack(handle, key);
+        return handle;
     } catch (const std::exception& e) {
         return 0;
     }
 }
 
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL
+Java_org_hyprclj_bindings_Rectangle_00024Builder_nativeCreate(
+    JNIEnv* env, jclass clazz,
+    jint r, jint g, jint b, jint a,
+    jint borderR, jint borderG, jint borderB, jint borderA,
+    jint borderThickness, jint rounding,
+    jint width, jint height, jfloat alpha) {
+
+    return createRectangle(r, g, b, a, borderR, borderG, borderB, borderA, borderThickness, rounding, width, height);
+}
+
+// Colors are packed 0xRRGGBBAA; sizes are size specs
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Rectangle_00024Batch_nativeCreateMany(
+    JNIEnv* env, jclass clazz, jlong parent, jint count,
+    jobject colors, jobject borderColors, jobject borders, jobject roundings,
+    jobject widths, jobject heights, jobject xs, jobject ys) {
+
+    count = std::max(count, 0);
+    const CIntColumn colorCol(env, colors, count, "colors"), borderColorCol(env, borderColors, count, "borderColors");
+    const CIntColumn borderCol(env, borders, count, "borders"), roundingCol(env, roundings, count, "roundings");
+    const CIntColumn widthCol(env, widths, count, "widths"), heightCol(env, heights, count, "heights");
+    const CIntColumn xCol(env, xs, count, "xs"), yCol(env, ys, count, "ys");
+    if (env->ExceptionCheck()) return nullptr;
+
+    std::vector<jlong> handles(count);
+    for (jint i = 0; i < count; ++i) {
+        const uint32_t c  = (uint32_t)colorCol.at(i, (jint)0xFFFFFFFF);
+        const uint32_t bc = (uint32_t)borderColorCol.at(i, 0x000000FF);
+        handles[i] = createRectangle((c >> 24) & 0xFF, (c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF,
+                                     (bc >> 24) & 0xFF, (bc >> 16) & 0xFF, (bc >> 8) & 0xFF, bc & 0xFF,
+                                     borderCol.at(i, 0), roundingCol.at(i, 0), widthCol.at(i, -1), heightCol.at(i, -1));
+    }
+    return bulkFinish(env, parent, handles, xCol, yCol);
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Rectangle_nativeSetColor(
+    JNIEnv* env, jobject obj, jlong handle, jint r, jint g, jint b, jint a) {
+
+    auto rect = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CRectangleElement>*>(handle);
+    if (!rect) return;
+
+    rect->rebuild()->color(paletteColor(r, g, b, a))->commence();
+    paletteBind(rect, r);
+}
+
 } // extern "C"
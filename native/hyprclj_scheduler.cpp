@@ -0,0 +1,210 @@
+#include <jni.h>
+#include <hyprtoolkit/core/Backend.hpp>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "hyprclj_scheduler.hpp"
+
+using namespace Hyprtoolkit;
+
+extern JavaVM* g_jvm;
+extern JNIEnv* getEnv();
+
+// Frame scheduler
+//
+// Resumable Java tasks (Backend$Task) are queued in priority lanes and pumped
+// from a single backend idle / next-frame timer. Each pump is one "frame":
+// tasks run in lane order until the frame budget is spent, then the pump
+// yields back to the event loop so input can be dispatched, and resumes on
+// the next frame boundary.
+//
+// Native frame work (relayout of invalidated containers) runs at the end of
+// a pump, after the tasks, so it sees every change the frame made.
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Keep in sync with Backend.LANE_*
+enum eLane : int {
+    LANE_INPUT = 0,
+    LANE_TIMER,
+    LANE_IDLE,
+    LANE_COUNT,
+};
+
+struct SScheduler {
+    Hyprutils::Memory::CSharedPointer<IBackend> backend;
+    std::deque<jobject>                         lanes[LANE_COUNT];
+    jmethodID                                   runMethod = nullptr;
+
+    std::vector<std::pair<const void*, std::function<void()>>> frameWork;
+
+    bool                                        armed   = false;
+    bool                                        inFrame = false;
+    Clock::time_point                           frameStart;
+    Clock::time_point                           deadline;
+
+    std::chrono::milliseconds                   budget{8};
+    std::chrono::milliseconds                   interval{16};
+};
+
+SScheduler g_scheduler;
+
+int nextLane() {
+    for (int lane = 0; lane < LANE_COUNT; ++lane) {
+        if (!g_scheduler.lanes[lane].empty()) {
+            return lane;
+        }
+    }
+    return -1;
+}
+
+void pump();
+
+// Arm the pump once. Work queued from outside a frame starts on the next idle;
+// work left over when a frame runs out of budget resumes on the next frame.
+void arm(bool nextFrame) {
+    auto& s = g_scheduler;
+    if (s.armed || !s.backend) return;
+    s.armed = true;
+
+    if (!nextFrame) {
+        s.backend->addIdle([]() { pump(); });
+        return;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - s.frameStart);
+    auto delay   = std::max(std::chrono::milliseconds(0), s.interval - elapsed);
+    s.backend->addTimer(delay, [](auto timer, void* data) { pump(); }, nullptr, false);
+}
+
+void pump() {
+    auto& s = g_scheduler;
+    s.armed      = false;
+    s.inFrame    = true;
+    s.frameStart = Clock::now();
+    s.deadline   = s.frameStart + s.budget;
+
+    JNIEnv* env = getEnv();
+    bool    ran = false;
+
+    // Always pick the highest-priority lane, so input work queued by a task
+    // runs before the rest of a long idle job.
+    for (int lane = nextLane(); lane >= 0; lane = nextLane()) {
+        if (ran && Clock::now() >= s.deadline) break;
+
+        jobject  task = s.lanes[lane].front();
+        jboolean more = env->CallBooleanMethod(task, s.runMethod);
+        ran           = true;
+
+        if (env->ExceptionCheck()) {
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+            more = false;
+        }
+
+        if (!more) {
+            s.lanes[lane].pop_front();
+            env->DeleteGlobalRef(task);
+        }
+    }
+
+    // Requests made from here on land in the next frame
+    auto work = std::move(s.frameWork);
+    s.frameWork.clear();
+    for (auto& [key, fn] : work) {
+        fn();
+    }
+
+    s.inFrame = false;
+
+    if (nextLane() >= 0 || !s.frameWork.empty()) {
+        arm(true);
+    }
+}
+
+} // namespace
+
+void schedulerAttach(const Hyprutils::Memory::CSharedPointer<IBackend>& backend) {
+    if (!g_scheduler.backend) {
+        g_scheduler.backend = backend;
+    }
+}
+
+void schedulerRequest(const void* key, std::function<void()> fn) {
+    auto& s = g_scheduler;
+    if (!s.backend) {
+        fn();
+        return;
+    }
+
+    auto it = std::find_if(s.frameWork.begin(), s.frameWork.end(), [key](const auto& work) { return work.first == key; });
+    if (it != s.frameWork.end()) {
+        it->second = std::move(fn);
+        return;
+    }
+    s.frameWork.emplace_back(key, std::move(fn));
+
+    if (!s.inFrame) {
+        arm(false);
+    }
+}
+
+void schedulerCancel(const void* key) {
+    std::erase_if(g_scheduler.frameWork, [key](const auto& work) { return work.first == key; });
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Backend_nativeSchedule(
+    JNIEnv* env, jobject obj, jlong handle, jint lane, jobject task) {
+
+    auto backend = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(handle);
+    if (!backend || !task) return;
+
+    auto& s = g_scheduler;
+    if (!s.backend) {
+        s.backend = backend;
+    }
+    if (!s.runMethod) {
+        jclass taskClass = env->FindClass("org/hyprclj/bindings/Backend$Task");
+        s.runMethod      = env->GetMethodID(taskClass, "run", "()Z");
+    }
+
+    if (lane < 0 || lane >= LANE_COUNT) {
+        lane = LANE_IDLE;
+    }
+
+    s.lanes[lane].push_back(env->NewGlobalRef(task));
+
+    // Work queued from inside a frame is picked up by the running pump
+    if (!s.inFrame) {
+        arm(false);
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Backend_nativeShouldYield(JNIEnv* env, jclass clazz) {
+    // Outside a scheduler frame there is no deadline to honour
+    if (!g_scheduler.inFrame) return false;
+    return Clock::now() >= g_scheduler.deadline;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Backend_nativeSetFrameBudget(
+    JNIEnv* env, jclass clazz, jint budgetMs, jint intervalMs) {
+
+    if (budgetMs > 0) {
+        g_scheduler.budget = std::chrono::milliseconds(budgetMs);
+    }
+    if (intervalMs > 0) {
+        g_scheduler.interval = std::chrono::milliseconds(intervalMs);
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <hyprtoolkit/core/Backend.hpp>
+#include <functional>
+
+// Frame scheduler (hyprclj_scheduler.cpp)
+//
+// Besides Java tasks, the pump runs native per-frame work: a request is
+// keyed by its owner, and requests made again before the frame runs are
+// coalesced into one.
+
+// The backend frames are pumped on (Backend.create)
+void schedulerAttach(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IBackend>& backend);
+
+// Run fn once, after the Java tasks of the next frame. A pending request
+// with the same key is replaced. Runs fn at once when there is no backend.
+void schedulerRequest(const void* key, std::function<void()> fn);
+
+// Drop a pending request (its owner is going away)
+void schedulerCancel(const void* key);
@@ -2,6 +2,10 @@
 #include <hyprtoolkit/element/ScrollArea.hpp>
 #include <hyprutils/math/Vector2D.hpp>
 
+#include "hyprclj_layout.hpp"
+
+#include "hyprclj_state.hpp"
+
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
 
@@ -24,13 +28,12 @@ Java_org_hyprclj_bindings_ScrollArea_00024Builder_nativeCreate(
         }
 
         // Set size if specified
-        if (width > 0 && height > 0) {
-            builder->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      Vector2D{(double)width, (double)height}));
+        if (sizeSpecified(width, height)) {
+            builder->size(sizeFromSpec(width, height));
         }
 
         auto scrollArea = builder->commence();
+        sizeNoteFill(scrollArea, width, height);
         if (!scrollArea) {
             return 0;
         }
@@ -65,6 +68,7 @@ Java_org_hyprclj_bindings_ScrollArea_nativeSetScroll(
     if (!scrollArea) return;
 
     scrollArea->setScroll(Vector2D{(double)x, (double)y});
+    stateRefreshScroll();
 }
 
 } // extern "C"
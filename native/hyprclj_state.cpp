@@ -0,0 +1,252 @@
+#include <jni.h>
+#include <hyprtoolkit/core/CoreMacros.hpp>  // Must be included first for HT_HIDDEN
+#include <hyprtoolkit/window/Window.hpp>
+#include <hyprtoolkit/element/ScrollArea.hpp>
+#include <hyprutils/math/Vector2D.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <unordered_map>
+#include <vector>
+
+#include "hyprclj_mouse.hpp"
+#include "hyprclj_state.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::Vector2D;
+
+extern JavaVM* g_jvm;
+extern JNIEnv* getEnv();
+
+// Focus tracked by the keyboard dispatcher (hyprclj_input.cpp)
+extern jlong inputFocusedHandle(IWindow* window);
+
+// Shared window state pages
+//
+// Each window can expose a small block of native memory to Java as a direct
+// ByteBuffer. Native code updates it as events arrive (resize, pointer
+// motion over the root element, key events, focus changes, scrolling) and
+// Java reads it with plain loads - no JNI call, no array allocation.
+//
+// Writes are bracketed by a sequence counter (seqlock): it is odd while an
+// update is in progress, so a reader that sees the same even value before
+// and after its loads got a consistent snapshot. Only the UI thread writes.
+//
+// The page memory is a direct buffer allocated by Java, so readers can
+// never outlive it. We hold a global reference to it while the window is
+// open; closing the window drops its state and the reference, and the page
+// keeps its last values for whoever still reads it.
+namespace {
+
+// Keep in sync with WindowState.SCROLL_SLOTS and the offsets there
+constexpr int SCROLL_SLOTS = 32;
+
+struct alignas(64) SStatePage {
+    int32_t seq         = 0;    //  0
+    int32_t width       = 0;    //  4  pixel size
+    int32_t height      = 0;    //  8
+    float   scale       = 1.0f; // 12
+    double  pointerX    = 0;    // 16  over the root element
+    double  pointerY    = 0;    // 24
+    int32_t modifiers   = 0;    // 32  xkb modifier mask of the last key event
+    int32_t scrollCount = 0;    // 36
+    int64_t focused     = 0;    // 40  handle of the focused element, 0 if none
+    int32_t scroll[SCROLL_SLOTS * 2] = {}; // 48  x, y per registered scroll area
+};
+
+static_assert(offsetof(SStatePage, pointerX) == 16);
+static_assert(offsetof(SStatePage, focused) == 40);
+static_assert(offsetof(SStatePage, scroll) == 48);
+static_assert(sizeof(SStatePage) == 320); // WindowState.PAGE_SIZE
+
+struct SWindowState {
+    SStatePage*                                                              page   = nullptr; // in buffer
+    jobject                                                                  buffer = nullptr; // global ref
+    Hyprutils::Memory::CWeakPointer<IWindow>                                 window;
+    Hyprutils::Memory::CSharedPointer<Hyprutils::Signal::CSignalListener>    resizeListener;
+    std::vector<Hyprutils::Memory::CWeakPointer<CScrollAreaElement>>         scrollAreas;
+};
+
+std::unordered_map<IWindow*, SWindowState> g_states;
+
+template <typename T>
+void put(T& field, T value) {
+    std::atomic_ref<T>(field).store(value, std::memory_order_relaxed);
+}
+
+// Seqlock write section
+template <typename F>
+void write(SStatePage& page, F&& update) {
+    std::atomic_ref<int32_t> seq(page.seq);
+    seq.store(page.seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    update(page);
+    seq.store(page.seq + 1, std::memory_order_release);
+}
+
+void refreshScroll(SWindowState& state, SStatePage& page) {
+    for (size_t i = 0; i < state.scrollAreas.size(); ++i) {
+        auto area = state.scrollAreas[i].lock();
+        if (!area) continue;
+        auto scroll = area->getCurrentScroll();
+        put(page.scroll[i * 2], (int32_t)scroll.x);
+        put(page.scroll[i * 2 + 1], (int32_t)scroll.y);
+    }
+}
+
+void refreshWindow(SWindowState& state) {
+    auto window = state.window.lock();
+    if (!window) return;
+
+    write(*state.page, [&](SStatePage& page) {
+        auto size = window->pixelSize();
+        put(page.width, (int32_t)size.x);
+        put(page.height, (int32_t)size.y);
+        put(page.scale, (float)window->scale());
+        put(page.focused, (int64_t)inputFocusedHandle(window.get()));
+        refreshScroll(state, page);
+    });
+}
+
+SWindowState* stateFor(IWindow* window) {
+    auto it = g_states.find(window);
+    return it == g_states.end() ? nullptr : &it->second;
+}
+
+// Publish the window's state in page (a direct buffer of at least
+// sizeof(SStatePage) bytes, 64-byte aligned); a later page replaces it
+SWindowState& createState(JNIEnv* env, const Hyprutils::Memory::CSharedPointer<IWindow>& window, jobject buffer, void* memory) {
+    auto& state = g_states[window.get()];
+    if (state.buffer) {
+        env->DeleteGlobalRef(state.buffer);
+    }
+    state.buffer = env->NewGlobalRef(buffer);
+    state.page   = new (memory) SStatePage();
+    if (state.resizeListener) {
+        write(*state.page, [&](SStatePage& page) { put(page.scrollCount, (int32_t)state.scrollAreas.size()); });
+        refreshWindow(state);
+        return state;
+    }
+
+    state.window = window;
+
+    IWindow* raw         = window.get();
+    state.resizeListener = window->m_events.resized.listen([raw](const Vector2D&) {
+        if (auto* state = stateFor(raw)) {
+            refreshWindow(*state);
+        }
+    });
+
+    // Pointer motion over the root element; also a cheap moment to pick up
+    // scroll offsets changed by the wheel
+    if (window->m_rootElement) {
+        mouseTrackPointer(window->m_rootElement, [raw](const Vector2D& pos) {
+            auto* state = stateFor(raw);
+            if (!state) return;
+            write(*state->page, [&](SStatePage& page) {
+                put(page.pointerX, pos.x);
+                put(page.pointerY, pos.y);
+                refreshScroll(*state, page);
+            });
+        });
+    }
+
+    refreshWindow(state);
+    return state;
+}
+
+} // namespace
+
+void stateSetModifiers(IWindow* window, uint32_t modifiers) {
+    auto* state = stateFor(window);
+    if (!state) return;
+    write(*state->page, [&](SStatePage& page) {
+        put(page.modifiers, (int32_t)modifiers);
+        refreshScroll(*state, page);
+    });
+}
+
+void stateSetFocused(IWindow* window, jlong elementHandle) {
+    auto* state = stateFor(window);
+    if (!state) return;
+    write(*state->page, [&](SStatePage& page) { put(page.focused, (int64_t)elementHandle); });
+}
+
+void stateForgetWindow(IWindow* window) {
+    auto it = g_states.find(window);
+    if (it == g_states.end()) return;
+
+    if (it->second.buffer) {
+        getEnv()->DeleteGlobalRef(it->second.buffer);
+    }
+    g_states.erase(it);
+}
+
+void stateRefreshScroll() {
+    for (auto& [window, state] : g_states) {
+        if (state.scrollAreas.empty()) continue;
+        write(*state.page, [&](SStatePage& page) { refreshScroll(state, page); });
+    }
+}
+
+extern "C" {
+
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Window_nativeStatePage(JNIEnv* env, jobject obj, jlong handle, jobject page) {
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window || !page) return JNI_FALSE;
+
+    void* memory = env->GetDirectBufferAddress(page);
+    if (!memory || env->GetDirectBufferCapacity(page) < (jlong)sizeof(SStatePage) ||
+        reinterpret_cast<uintptr_t>(memory) % alignof(SStatePage) != 0) {
+        return JNI_FALSE;
+    }
+
+    createState(env, window, page, memory);
+    return JNI_TRUE;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Window_nativeRegisterScrollArea(
+    JNIEnv* env, jobject obj, jlong handle, jlong scrollHandle) {
+
+    auto window     = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    auto scrollArea = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CScrollAreaElement>*>(scrollHandle);
+    if (!window || !scrollArea) return -1;
+
+    auto* state = stateFor(window.get());
+    if (!state) return -1;
+
+    // Reuse the slot of a scroll area that is gone
+    int slot = -1;
+    for (size_t i = 0; i < state->scrollAreas.size(); ++i) {
+        auto area = state->scrollAreas[i].lock();
+        if (area == scrollArea) return (jint)i;
+        if (!area && slot < 0) slot = (int)i;
+    }
+    if (slot < 0) {
+        if (state->scrollAreas.size() >= (size_t)SCROLL_SLOTS) return -1;
+        slot = (int)state->scrollAreas.size();
+        state->scrollAreas.emplace_back();
+    }
+    state->scrollAreas[slot] = scrollArea;
+
+    write(*state->page, [&](SStatePage& page) {
+        put(page.scrollCount, (int32_t)state->scrollAreas.size());
+        refreshScroll(*state, page);
+    });
+    return slot;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Window_nativeSyncState(JNIEnv* env, jobject obj, jlong handle) {
+    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
+    if (!window) return;
+
+    if (auto* state = stateFor(window.get())) {
+        refreshWindow(*state);
+    }
+}
+
+} // extern "C"
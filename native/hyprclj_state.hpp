@@ -0,0 +1,25 @@
+#pragma once
+
+#include <jni.h>
+#include <cstdint>
+
+namespace Hyprtoolkit {
+class IWindow;
+}
+
+// Shared window state pages (hyprclj_state.cpp)
+//
+// Event sources push their state here; each call is a no-op for windows
+// whose page Java never asked for.
+
+// Modifier mask of the latest key event (hyprclj_input.cpp)
+void stateSetModifiers(Hyprtoolkit::IWindow* window, uint32_t modifiers);
+
+// Handle of the focused element, 0 when nothing is focused (hyprclj_input.cpp)
+void stateSetFocused(Hyprtoolkit::IWindow* window, jlong elementHandle);
+
+// Re-read the registered scroll areas' offsets (hyprclj_scrollarea.cpp)
+void stateRefreshScroll();
+
+// The window is closing: stop publishing its state (hyprclj_window.cpp)
+void stateForgetWindow(Hyprtoolkit::IWindow* window);
@@ -0,0 +1,84 @@
+#include <jni.h>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "hyprclj_strings.hpp"
+
+// Strings
+//
+// The intern table only grows: ids are handed to Java, which caches them
+// per String, so an id must stay valid for the life of the process. Callers
+// intern bounded sets (fonts, align names, labels of a fixed UI), not
+// arbitrary content.
+//
+// Java interns from any thread (Strings keeps a concurrent map), so the
+// table is behind a mutex, lookups included. Strings sit in a deque, whose
+// elements never move as it grows, so the reference internedString returns
+// stays valid after the lock is released.
+//
+// hyprtoolkit builders take std::string by value, so a string handed to a
+// builder is still copied once there; short ones fit the small-string
+// buffer and don't allocate.
+namespace {
+
+struct SInternTable {
+    std::mutex                           mutex;
+    std::deque<std::string>              strings;
+    std::unordered_map<std::string, int> ids;
+};
+
+SInternTable      g_strings;
+const std::string g_empty;
+
+} // namespace
+
+const std::string& internedString(jint id) {
+    std::lock_guard lock(g_strings.mutex);
+    if (id < 0 || (size_t)id >= g_strings.strings.size()) return g_empty;
+    return g_strings.strings[id];
+}
+
+CJniString::CJniString(JNIEnv* env, jstring str) {
+    m_inline[0] = '\0';
+    if (!str) return;
+
+    const jsize chars = env->GetStringLength(str);
+    m_length          = (size_t)env->GetStringUTFLength(str);
+
+    // GetStringUTFRegion writes a terminating NUL as well
+    if (m_length < INLINE) {
+        env->GetStringUTFRegion(str, 0, chars, m_inline);
+    } else {
+        m_heap.resize(m_length + 1);
+        env->GetStringUTFRegion(str, 0, chars, m_heap.data());
+        m_heap.resize(m_length);
+    }
+}
+
+extern "C" {
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Strings_nativeIntern(JNIEnv* env, jclass clazz, jstring str) {
+    CJniString s(env, str);
+    const auto view = s.view();
+    auto&      t    = g_strings;
+
+    std::lock_guard lock(t.mutex);
+    auto it = t.ids.find(std::string(view));
+    if (it != t.ids.end()) return it->second;
+
+    const int id = (int)t.strings.size();
+    t.strings.emplace_back(view);
+    t.ids.emplace(t.strings.back(), id);
+    return id;
+}
+
+JNIEXPORT jint JNICALL
+Java_org_hyprclj_bindings_Strings_nativeCount(JNIEnv* env, jclass clazz) {
+    std::lock_guard lock(g_strings.mutex);
+    return (jint)g_strings.strings.size();
+}
+
+} // extern "C"
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <jni.h>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Strings (hyprclj_strings.cpp)
+//
+// JNI string marshaling. Strings Java sends over and over (font families,
+// align names, repeated labels) are interned once with Strings.intern and
+// cross as an int id. Other strings are copied with GetStringUTFRegion into
+// a stack buffer, so reading them allocates nothing unless they are long.
+
+// An interned string by id; empty for -1 or an unknown id. Callable from
+// any thread; the reference stays valid for the life of the process.
+const std::string& internedString(jint id);
+
+// A jstring argument read into a small inline buffer (heap past that)
+class CJniString {
+  public:
+    CJniString(JNIEnv* env, jstring str);
+
+    CJniString(const CJniString&)            = delete;
+    CJniString& operator=(const CJniString&) = delete;
+
+    std::string_view view() const {
+        return {m_heap.empty() ? m_inline : m_heap.data(), m_length};
+    }
+
+    std::string str() const {
+        return std::string(view());
+    }
+
+  private:
+    static constexpr size_t INLINE = 256;
+
+    char        m_inline[INLINE];
+    std::string m_heap;
+    size_t      m_length = 0;
+};
+
+// A string argument that may be interned: an id >= 0 wins over str
+inline std::string stringArg(JNIEnv* env, jstring str, jint id) {
+    if (id >= 0) return internedString(id);
+    return CJniString(env, str).str();
+}
@@ -1,7 +1,15 @@
 #include <jni.h>
 #include <hyprtoolkit/element/Text.hpp>
 #include <hyprutils/math/Vector2D.hpp>
+#include <algorithm>
 #include <string>
+#include <vector>
+
+#include "hyprclj_bulk.hpp"
+#include "hyprclj_layout.hpp"
+#include "hyprclj_palette.hpp"
+#include "hyprclj_pool.hpp"
+#include "hyprclj_strings.hpp"
 
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
@@ -9,79 +17,157 @@ using Hyprutils::Math::Vector2D;
 extern JavaVM* g_jvm;
 extern JNIEnv* getEnv();
 
-extern "C" {
-
-JNIEXPORT jlong JNICALL
-Java_org_hyprclj_bindings_Text_00024Builder_nativeCreate(
-    JNIEnv* env, jclass clazz,
-    jstring content, jint fontSize, jstring fontFamily,
-    jint r, jint g, jint b, jint a, jstring align, jfloat alpha) {
+namespace {
 
+jlong createText(std::string content, jint fontSize, const std::string& fontFamily,
+                 jint r, jint g, jint b, jint a, jfloat alpha) {
     try {
-        const char* contentChars = env->GetStringUTFChars(content, nullptr);
-        std::string contentStr(contentChars);
-        env->ReleaseStringUTFChars(content, contentChars);
-
-        const char* fontFamilyChars = env->GetStringUTFChars(fontFamily, nullptr);
-        std::string fontFamilyStr(fontFamilyChars);
-        env->ReleaseStringUTFChars(fontFamily, fontFamilyChars);
-
-        const char* alignChars = env->GetStringUTFChars(align, nullptr);
-        std::string alignStr(alignChars);
-        env->ReleaseStringUTFChars(align, alignChars);
-
-        auto builder = CTextBuilder::begin();
-        builder->text(std::move(contentStr));
+        // Reuse a parked text element of the same shape when there is one
+        const uint32_t key    = poolKey(POOL_TEXT, fontFamily.empty() ? 0 : 1);
+        const jlong    pooled = poolAcquire(key);
+        auto pooledText = pooled ? *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CTextElement>*>(pooled) : nullptr;
+
+        // Measured through the shared text cache by native containers
+        STextStyle style{content, fontFamily, (float)fontSize};
+
+        auto builder = pooledText ? pooledText->rebuild() : CTextBuilder::begin();
+        if (pooledText) {
+            // Back to sized by content, like a fresh element: the parked
+            // one may have had Element.setSize
+            builder->size(sizeFromSpec(-1, -1));
+        }
+        builder->text(std::move(content));
         builder->fontSize(CFontSize(CFontSize::HT_FONT_ABSOLUTE, (float)fontSize));
 
-        if (!fontFamilyStr.empty()) {
-            builder->fontFamily(std::move(fontFamilyStr));
+        if (!fontFamily.empty()) {
+            builder->fontFamily(std::string(fontFamily));
         }
 
-        // Set color as a function returning CHyprColor
-        builder->color([r, g, b, a]() {
-            return CHyprColor((float)r/255.0f, (float)g/255.0f, (float)b/255.0f, (float)a/255.0f);
-        });
+        // Set color as a function returning CHyprColor (fixed, or read from
+        // a palette slot)
+        builder->color(paletteColor(r, g, b, a));
 
         // Set separate alpha multiplier for fade effects
         builder->a(alpha);
 
         auto text = builder->commence();
+        if (pooled) {
+            paletteBind(pooledText, r);
+            layoutItemFor(pooledText).text = std::move(style);
+            return pooled;
+        }
         if (!text) {
             return 0;
         }
+        paletteBind(text, r);
+        layoutItemFor(text).text = std::move(style);
 
-        return reinterpret_cast<jlong>(new auto(text));
+        jlong handle = reinterpret_cast<jlong>(new auto(text));
+        poolTrack(handle, key);
+        return handle;
     } catch (const std::exception& e) {
         return 0;
     }
 }
 
+} // namespace
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL
+Java_org_hyprclj_bindings_Text_00024Builder_nativeCreate(
+    JNIEnv* env, jclass clazz,
+    jstring content, jint contentId, jint fontSize, jint fontFamilyId,
+    jint r, jint g, jint b, jint a, jint alignId, jfloat alpha) {
+
+    // Font family and align are interned ids (Strings.intern); content
+    // is interned when the caller asked for it
+    return createText(stringArg(env, content, contentId), fontSize, internedString(fontFamilyId), r, g, b, a, alpha);
+}
+
+// A content id >= 0 wins over contents[i]; colors are packed 0xRRGGBBAA
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Text_00024Batch_nativeCreateMany(
+    JNIEnv* env, jclass clazz, jlong parent, jint count,
+    jobject contentIds, jobjectArray contents, jint fontFamilyId,
+    jobject fontSizes, jobject colors, jobject xs, jobject ys) {
+
+    count = std::max(count, 0);
+    if (contents && env->GetArrayLength(contents) < count) {
+        bulkThrow(env, "contents: fewer strings than count");
+        return nullptr;
+    }
+    const CIntColumn   idCol(env, contentIds, count, "contentIds"), sizeCol(env, fontSizes, count, "fontSizes");
+    const CIntColumn   colorCol(env, colors, count, "colors"), xCol(env, xs, count, "xs"), yCol(env, ys, count, "ys");
+    if (env->ExceptionCheck()) return nullptr;
+    const std::string& fontFamily = internedString(fontFamilyId);
+
+    std::vector<jlong> handles(count);
+    for (jint i = 0; i < count; ++i) {
+        std::string content;
+        if (const jint id = idCol.at(i, -1); id >= 0) {
+            content = internedString(id);
+        } else if (contents) {
+            auto str = (jstring)env->GetObjectArrayElement(contents, i);
+            content  = CJniString(env, str).str();
+            env->DeleteLocalRef(str);
+        }
+
+        const uint32_t c = (uint32_t)colorCol.at(i, (jint)0xFFFFFFFF);
+        handles[i] = createText(std::move(content), sizeCol.at(i, 12), fontFamily,
+                                (c >> 24) & 0xFF, (c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF, 1.0f);
+    }
+    return bulkFinish(env, parent, handles, xCol, yCol);
+}
+
 JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Text_nativeSetContent(
     JNIEnv* env, jobject obj, jlong handle, jstring content) {
 
-    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
-    if (!element) return;
+    auto text = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CTextElement>*>(handle);
+    if (!text) return;
 
-    const char* contentChars = env->GetStringUTFChars(content, nullptr);
-    std::string contentStr(contentChars);
-    env->ReleaseStringUTFChars(content, contentChars);
+    const CJniString contentStr(env, content);
 
-    // Note: Updating text content dynamically may require rebuilding the element
-    // This is a simplified stub
-    // Note: This is simplified
+    // Same content: nothing to reshape (a counter re-rendered every frame)
+    auto& style = layoutItemFor(text).text;
+    if (style) {
+        if (style->content == contentStr.view()) return;
+        style->content = contentStr.view();
+    }
+
+    // rebuild() re-opens the builder on the live element: no new element,
+    // no re-parenting, only the text is re-shaped
+    text->rebuild()->text(contentStr.str())->commence();
+    layoutInvalidate(text.get());
 }
 
 JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Text_nativeSetFontSize(
     JNIEnv* env, jobject obj, jlong handle, jint fontSize) {
 
-    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
-    if (!element) return;
+    auto text = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CTextElement>*>(handle);
+    if (!text) return;
+
+    auto& style = layoutItemFor(text).text;
+    if (style) {
+        if (style->size == (float)fontSize) return;
+        style->size = (float)fontSize;
+    }
+
+    text->rebuild()->fontSize(CFontSize(CFontSize::HT_FONT_ABSOLUTE, (float)fontSize))->commence();
+    layoutInvalidate(text.get());
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Text_nativeSetColor(
+    JNIEnv* env, jobject obj, jlong handle, jint r, jint g, jint b, jint a) {
+
+    auto text = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<CTextElement>*>(handle);
+    if (!text) return;
 
-    // Note: Updating font size dynamically may require rebuilding the element
-    // This is a simplified stub
+    text->rebuild()->color(paletteColor(r, g, b, a))->commence();
+    paletteBind(text, r);
 }
 
 } // extern "C"
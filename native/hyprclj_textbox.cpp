@@ -1,7 +1,15 @@
 #include <jni.h>
 #include <hyprtoolkit/element/Textbox.hpp>
 #include <hyprutils/math/Vector2D.hpp>
+#include <algorithm>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "hyprclj_layout.hpp"
+#include "hyprclj_scheduler.hpp"
+#include "hyprclj_strings.hpp"
 
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
@@ -9,6 +17,320 @@ using Hyprutils::Math::Vector2D;
 extern JavaVM* g_jvm;
 extern JNIEnv* getEnv();
 
+// Native text model
+//
+// Each Textbox owns a gap buffer holding its UTF-8 text. Key events are
+// applied to the buffer directly (insert/delete at the cursor is O(1)
+// amortized, independent of text length).
+//
+// Publishing an edit is not: hyprtoolkit only takes a textbox's whole text
+// (defaultText), and the change callback receives the whole text as a Java
+// string, so both are O(n) in the text length. They are deferred to the
+// frame scheduler instead of running per keystroke: a burst of keys (key
+// repeat, paste, fast typing) within a frame costs one rebuild and one
+// change callback with the latest text. Submit flushes a pending edit
+// first, so callbacks always arrive in order.
+namespace {
+
+// xkb keysyms
+constexpr uint32_t KEY_BACKSPACE = 0xff08;
+constexpr uint32_t KEY_RETURN    = 0xff0d;
+constexpr uint32_t KEY_KP_ENTER  = 0xff8d;
+constexpr uint32_t KEY_HOME      = 0xff50;
+constexpr uint32_t KEY_LEFT      = 0xff51;
+constexpr uint32_t KEY_RIGHT     = 0xff53;
+constexpr uint32_t KEY_END       = 0xff57;
+constexpr uint32_t KEY_DELETE    = 0xffff;
+constexpr uint32_t KEY_A_LOWER   = 0x0061;
+constexpr uint32_t KEY_A_UPPER   = 0x0041;
+
+// xkb modifier mask bits
+constexpr uint32_t MOD_SHIFT = 1 << 0;
+constexpr uint32_t MOD_CTRL  = 1 << 2;
+
+class CGapBuffer {
+  public:
+    size_t size() const {
+        return m_data.size() - (m_gapEnd - m_gapStart);
+    }
+
+    unsigned char at(size_t pos) const {
+        return m_data[pos < m_gapStart ? pos : pos + (m_gapEnd - m_gapStart)];
+    }
+
+    void insert(size_t pos, std::string_view bytes) {
+        moveGap(pos);
+        if (m_gapEnd - m_gapStart < bytes.size()) {
+            grow(bytes.size());
+        }
+        std::copy(bytes.begin(), bytes.end(), m_data.begin() + m_gapStart);
+        m_gapStart += bytes.size();
+    }
+
+    void erase(size_t pos, size_t len) {
+        moveGap(pos);
+        m_gapEnd += len;
+    }
+
+    void assign(std::string_view bytes) {
+        m_data.assign(bytes.begin(), bytes.end());
+        m_gapStart = m_gapEnd = m_data.size();
+    }
+
+    std::string str() const {
+        std::string out;
+        out.reserve(size());
+        out.append(m_data.begin(), m_data.begin() + m_gapStart);
+        out.append(m_data.begin() + m_gapEnd, m_data.end());
+        return out;
+    }
+
+    // UTF-8 codepoint boundaries around a byte offset
+    size_t prevBoundary(size_t pos) const {
+        if (pos == 0) return 0;
+        do {
+            --pos;
+        } while (pos > 0 && (at(pos) & 0xC0) == 0x80);
+        return pos;
+    }
+
+    size_t nextBoundary(size_t pos) const {
+        const size_t len = size();
+        if (pos >= len) return len;
+        do {
+            ++pos;
+        } while (pos < len && (at(pos) & 0xC0) == 0x80);
+        return pos;
+    }
+
+  private:
+    // Edits near the cursor only move a few bytes across the gap
+    void moveGap(size_t pos) {
+        if (pos < m_gapStart) {
+            const size_t n = m_gapStart - pos;
+            std::copy_backward(m_data.begin() + pos, m_data.begin() + m_gapStart, m_data.begin() + m_gapEnd);
+            m_gapStart -= n;
+            m_gapEnd -= n;
+        } else if (pos > m_gapStart) {
+            const size_t n = pos - m_gapStart;
+            std::copy(m_data.begin() + m_gapEnd, m_data.begin() + m_gapEnd + n, m_data.begin() + m_gapStart);
+            m_gapStart += n;
+            m_gapEnd += n;
+        }
+    }
+
+    // Double the capacity so growth is amortized O(1) per inserted byte
+    void grow(size_t needed) {
+        const size_t tail    = m_data.size() - m_gapEnd;
+        const size_t newSize = std::max(m_data.size() * 2, m_data.size() + needed + 64);
+        m_data.resize(newSize);
+        std::copy_backward(m_data.begin() + m_gapEnd, m_data.begin() + m_gapEnd + tail, m_data.end());
+        m_gapEnd = newSize - tail;
+    }
+
+    std::vector<char> m_data;
+    size_t            m_gapStart = 0;
+    size_t            m_gapEnd   = 0;
+};
+
+struct STextModel {
+    Hyprutils::Memory::CWeakPointer<CTextboxElement> textbox;
+    CGapBuffer                                       buffer;
+    size_t                                           cursor = 0; // byte offset, on a codepoint boundary
+    size_t                                           anchor = 0; // selection is [min, max) of cursor/anchor
+    jobject                                          onChange = nullptr;
+    jobject                                          onSubmit = nullptr;
+    bool                                             pushing  = false; // inside our own rebuild()
+    bool                                             pending  = false; // edited since the last flush
+};
+
+std::unordered_map<IElement*, STextModel> g_textModels;
+jmethodID                                 g_acceptMethod = nullptr;
+
+STextModel* modelFor(jlong handle) {
+    auto element = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
+    if (!element) return nullptr;
+    auto it = g_textModels.find(element.get());
+    return it == g_textModels.end() ? nullptr : &it->second;
+}
+
+void callConsumer(jobject callback, const std::string& text) {
+    if (!callback) return;
+
+    JNIEnv* env = getEnv();
+    if (!g_acceptMethod) {
+        jclass consumerClass = env->FindClass("java/util/function/Consumer");
+        g_acceptMethod       = env->GetMethodID(consumerClass, "accept", "(Ljava/lang/Object;)V");
+    }
+
+    jstring jtext = env->NewStringUTF(text.c_str());
+    env->CallVoidMethod(callback, g_acceptMethod, jtext);
+    env->DeleteLocalRef(jtext);
+
+    if (env->ExceptionCheck()) {
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+}
+
+bool hasSelection(const STextModel& model) {
+    return model.cursor != model.anchor;
+}
+
+void deleteSelection(STextModel& model) {
+    const size_t from = std::min(model.cursor, model.anchor);
+    const size_t to   = std::max(model.cursor, model.anchor);
+    model.buffer.erase(from, to - from);
+    model.cursor = model.anchor = from;
+}
+
+void moveCursor(STextModel& model, size_t pos, bool extend) {
+    model.cursor = pos;
+    if (!extend) {
+        model.anchor = pos;
+    }
+}
+
+// Push the buffer into the live element and notify Java: O(n), once per
+// frame at most
+void flush(STextModel& model) {
+    if (!model.pending) return;
+    model.pending = false;
+
+    const std::string text = model.buffer.str();
+    if (auto textbox = model.textbox.lock()) {
+        model.pushing = true;
+        textbox->rebuild()->defaultText(std::string(text))->commence();
+        model.pushing = false;
+    }
+    callConsumer(model.onChange, text);
+}
+
+void textChanged(STextModel& model) {
+    if (model.pending) return;
+    model.pending = true;
+
+    // Map nodes are stable, so the model's address keys the request; a
+    // forgotten model cancels it
+    IElement* element = model.textbox.get();
+    schedulerRequest(&model, [element]() {
+        auto it = g_textModels.find(element);
+        if (it != g_textModels.end()) flush(it->second);
+    });
+}
+
+// Edits made by the toolkit's own input handling: adopt its text
+void toolkitEdited(CTextboxElement* textbox, const std::string& text) {
+    auto it = g_textModels.find(textbox);
+    if (it == g_textModels.end() || it->second.pushing) return;
+
+    auto& model = it->second;
+    schedulerCancel(&model);
+    model.pending = false;
+    model.buffer.assign(text);
+    model.cursor = model.anchor = model.buffer.size();
+    callConsumer(model.onChange, text);
+}
+
+// Returns true when the key was consumed
+bool applyKey(STextModel& model, uint32_t keysym, const std::string& utf8, uint32_t modifiers) {
+    const bool shift = modifiers & MOD_SHIFT;
+    const bool ctrl  = modifiers & MOD_CTRL;
+    auto&      buf   = model.buffer;
+
+    switch (keysym) {
+        case KEY_RETURN:
+        case KEY_KP_ENTER:
+            flush(model);
+            callConsumer(model.onSubmit, buf.str());
+            return true;
+
+        case KEY_BACKSPACE:
+            if (hasSelection(model)) {
+                deleteSelection(model);
+            } else if (model.cursor > 0) {
+                const size_t from = buf.prevBoundary(model.cursor);
+                buf.erase(from, model.cursor - from);
+                model.cursor = model.anchor = from;
+            } else {
+                return true;
+            }
+            textChanged(model);
+            return true;
+
+        case KEY_DELETE:
+            if (hasSelection(model)) {
+                deleteSelection(model);
+            } else if (model.cursor < buf.size()) {
+                buf.erase(model.cursor, buf.nextBoundary(model.cursor) - model.cursor);
+            } else {
+                return true;
+            }
+            textChanged(model);
+            return true;
+
+        case KEY_LEFT: moveCursor(model, buf.prevBoundary(model.cursor), shift); return true;
+        case KEY_RIGHT: moveCursor(model, buf.nextBoundary(model.cursor), shift); return true;
+        case KEY_HOME: moveCursor(model, 0, shift); return true;
+        case KEY_END: moveCursor(model, buf.size(), shift); return true;
+
+        default: break;
+    }
+
+    if (ctrl) {
+        if (keysym == KEY_A_LOWER || keysym == KEY_A_UPPER) {
+            model.anchor = 0;
+            model.cursor = buf.size();
+            return true;
+        }
+        return false;
+    }
+
+    // Printable input (control characters are not inserted)
+    if (utf8.empty() || (unsigned char)utf8[0] < 0x20 || utf8[0] == 0x7f) {
+        return false;
+    }
+
+    if (hasSelection(model)) {
+        deleteSelection(model);
+    }
+    buf.insert(model.cursor, utf8);
+    model.cursor += utf8.size();
+    model.anchor = model.cursor;
+    textChanged(model);
+    return true;
+}
+
+} // namespace
+
+// Drop an element's text model and its callbacks (release / recycle)
+void textboxForgetElement(IElement* element) {
+    auto it = g_textModels.find(element);
+    if (it == g_textModels.end()) return;
+
+    auto&   model = it->second;
+    JNIEnv* env   = getEnv();
+    if (model.onChange) env->DeleteGlobalRef(model.onChange);
+    if (model.onSubmit) env->DeleteGlobalRef(model.onSubmit);
+    schedulerCancel(&model);
+    g_textModels.erase(it);
+}
+
+// Focused-element key dispatch (hyprclj_input.cpp). Returns false for
+// elements without a text model and for keys the model does not consume.
+bool textboxApplyKey(IElement* element, uint32_t keysym, bool pressed, const std::string& utf8, uint32_t modifiers) {
+    auto it = g_textModels.find(element);
+    if (it == g_textModels.end()) return false;
+    if (it->second.textbox.expired()) {
+        // Stale model of a destroyed textbox at a reused address
+        textboxForgetElement(element);
+        return false;
+    }
+    if (!pressed) return false;
+
+    return applyKey(it->second, keysym, utf8, modifiers);
+}
+
 extern "C" {
 
 JNIEXPORT jlong JNICALL
@@ -18,34 +340,41 @@ Java_org_hyprclj_bindings_Textbox_00024Builder_nativeCreate(
     jint width, jint height) {
 
     try {
-        const char* placeholderChars = env->GetStringUTFChars(placeholder, nullptr);
-        std::string placeholderStr(placeholderChars);
-        env->ReleaseStringUTFChars(placeholder, placeholderChars);
-
-        const char* initialChars = env->GetStringUTFChars(initialText, nullptr);
-        std::string initialStr(initialChars);
-        env->ReleaseStringUTFChars(initialText, initialChars);
+        const CJniString placeholderStr(env, placeholder);
+        const CJniString initialStr(env, initialText);
 
         auto builder = CTextboxBuilder::begin();
 
-        if (!placeholderStr.empty()) {
-            builder->placeholder(std::move(placeholderStr));
+        if (!placeholderStr.view().empty()) {
+            builder->placeholder(placeholderStr.str());
         }
 
-        // Note: Initial text might use a different method or property
-        // Skipping for POC - can be set after creation if needed
+        if (!initialStr.view().empty()) {
+            builder->defaultText(initialStr.str());
+        }
+
+        builder->onTextEdited([](Hyprutils::Memory::CSharedPointer<CTextboxElement> self, const std::string& text) {
+            toolkitEdited(self.get(), text);
+        });
 
-        if (width > 0 && height > 0) {
-            builder->size(CDynamicSize(CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      CDynamicSize::HT_SIZE_ABSOLUTE,
-                                      Vector2D{(double)width, (double)height}));
+        if (sizeSpecified(width, height)) {
+            builder->size(sizeFromSpec(width, height));
         }
 
         auto textbox = builder->commence();
+        sizeNoteFill(textbox, width, height);
         if (!textbox) {
             return 0;
         }
 
+        // Fresh model (replaces a stale one left at a reused address)
+        textboxForgetElement(textbox.get());
+        auto& model   = g_textModels[textbox.get()];
+        model         = STextModel{};
+        model.textbox = textbox;
+        model.buffer.assign(initialStr.view());
+        model.cursor = model.anchor = model.buffer.size();
+
         return reinterpret_cast<jlong>(new Hyprutils::Memory::CSharedPointer<IElement>(textbox));
     } catch (const std::exception& e) {
         return 0;
@@ -56,46 +385,84 @@ JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Textbox_00024Builder_nativeSetSubmitCallback(
     JNIEnv* env, jclass clazz, jlong handle, jobject callback) {
 
-    auto textbox = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
-    if (!textbox) return;
+    auto* model = modelFor(handle);
+    if (!model) return;
 
-    jobject globalCallback = env->NewGlobalRef(callback);
-
-    // For POC, submit callback is not fully implemented
-    // Would need to access textbox internal state and wire up submit event
-    // Stub for now
+    if (model->onSubmit) {
+        env->DeleteGlobalRef(model->onSubmit);
+    }
+    model->onSubmit = callback ? env->NewGlobalRef(callback) : nullptr;
 }
 
 JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Textbox_00024Builder_nativeSetChangeCallback(
     JNIEnv* env, jclass clazz, jlong handle, jobject callback) {
 
-    auto textbox = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IElement>*>(handle);
-    if (!textbox) return;
-
-    jobject globalCallback = env->NewGlobalRef(callback);
+    auto* model = modelFor(handle);
+    if (!model) return;
 
-    // Change callbacks would need Hyprtoolkit support
-    // For POC, we'll skip this
+    if (model->onChange) {
+        env->DeleteGlobalRef(model->onChange);
+    }
+    model->onChange = callback ? env->NewGlobalRef(callback) : nullptr;
 }
 
 JNIEXPORT jstring JNICALL
 Java_org_hyprclj_bindings_Textbox_nativeGetText(
     JNIEnv* env, jobject obj, jlong handle) {
 
-    // For POC, getting text from textbox is not implemented
-    // Would need access to internal textbox state
-    // Return empty string for now
-    return env->NewStringUTF("");
+    auto* model = modelFor(handle);
+    if (!model) return env->NewStringUTF("");
+
+    return env->NewStringUTF(model->buffer.str().c_str());
 }
 
 JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Textbox_nativeSetText(
     JNIEnv* env, jobject obj, jlong handle, jstring text) {
 
-    // For POC, setting text on textbox is not implemented
-    // Would require rebuilding the textbox element
-    // Stub for now
+    auto* model = modelFor(handle);
+    if (!model) return;
+
+    const CJniString textStr(env, text);
+
+    // Programmatic update: no change callback (and none left pending)
+    schedulerCancel(model);
+    model->pending = false;
+    model->buffer.assign(textStr.view());
+    model->cursor = model->anchor = model->buffer.size();
+    if (auto textbox = model->textbox.lock()) {
+        model->pushing = true;
+        textbox->rebuild()->defaultText(textStr.str())->commence();
+        model->pushing = false;
+    }
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Textbox_nativeHandleKey(
+    JNIEnv* env, jobject obj, jlong handle,
+    jint keysym, jboolean pressed, jstring utf8, jint modifiers) {
+
+    auto* model = modelFor(handle);
+    if (!model || !pressed) return false;
+
+    const CJniString utf8Str(env, utf8);
+    return applyKey(*model, (uint32_t)keysym, utf8Str.str(), (uint32_t)modifiers);
+}
+
+JNIEXPORT jintArray JNICALL
+Java_org_hyprclj_bindings_Textbox_nativeGetSelection(
+    JNIEnv* env, jobject obj, jlong handle) {
+
+    jint values[2] = {0, 0};
+    if (auto* model = modelFor(handle)) {
+        values[0] = (jint)std::min(model->cursor, model->anchor);
+        values[1] = (jint)std::max(model->cursor, model->anchor);
+    }
+
+    jintArray result = env->NewIntArray(2);
+    env->SetIntArrayRegion(result, 0, 2, values);
+    return result;
 }
 
 } // extern "C"
@@ -0,0 +1,162 @@
+#include <jni.h>
+#include <hyprtoolkit/core/CoreMacros.hpp>  // Must be included first for HT_HIDDEN
+#include <hyprtoolkit/element/Text.hpp>
+#include <functional>
+#include <limits>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "hyprclj_strings.hpp"
+#include "hyprclj_textcache.hpp"
+
+using namespace Hyprtoolkit;
+using Hyprutils::Math::Vector2D;
+
+// Text measurement cache
+//
+// hyprtoolkit shapes text inside the element and exposes only its size, so
+// what can be shared is the measurement: a layout pass over a table of
+// identical cells, or a counter re-rendered at 60 Hz, asks hyprtoolkit once
+// per distinct (content, font, size, constraints) and hits the cache after.
+//
+// Text.measure goes through the same cache; on a miss it measures with one
+// private text element that is never attached to a window.
+namespace {
+
+struct STextKey {
+    STextStyle style;
+    Vector2D   constraints;
+
+    bool operator==(const STextKey&) const = default;
+};
+
+struct STextKeyHash {
+    size_t operator()(const STextKey& key) const {
+        size_t h = std::hash<std::string>{}(key.style.content);
+        h ^= std::hash<std::string>{}(key.style.font) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= std::hash<float>{}(key.style.size) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= std::hash<double>{}(key.constraints.x) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= std::hash<double>{}(key.constraints.y) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
+struct SEntry {
+    STextKey key;
+    Vector2D size;
+};
+
+struct STextCache {
+    std::list<SEntry>                                                      lru; // front = most recent
+    std::unordered_map<STextKey, std::list<SEntry>::iterator, STextKeyHash> index;
+
+    size_t   bytes  = 0;
+    size_t   budget = 2 * 1024 * 1024;
+    uint64_t hits = 0, misses = 0, evictions = 0;
+};
+
+STextCache                                        g_textCache;
+Hyprutils::Memory::CSharedPointer<CTextElement> g_probe;
+
+// Rough footprint: the key is held twice (list and index) plus node overhead
+size_t entryBytes(const STextKey& key) {
+    return 2 * (sizeof(SEntry) + key.style.content.size() + key.style.font.size()) + 64;
+}
+
+void evictOverBudget() {
+    auto& c = g_textCache;
+    while (c.bytes > c.budget && !c.lru.empty()) {
+        const auto& last = c.lru.back();
+        c.bytes -= entryBytes(last.key);
+        c.index.erase(last.key);
+        c.lru.pop_back();
+        c.evictions++;
+    }
+}
+
+} // namespace
+
+std::optional<Vector2D> textCacheFind(const STextStyle& style, const Vector2D& constraints) {
+    auto& c  = g_textCache;
+    auto  it = c.index.find(STextKey{style, constraints});
+    if (it == c.index.end()) {
+        c.misses++;
+        return std::nullopt;
+    }
+
+    c.hits++;
+    c.lru.splice(c.lru.begin(), c.lru, it->second);
+    return it->second->size;
+}
+
+void textCacheStore(const STextStyle& style, const Vector2D& constraints, const Vector2D& size) {
+    auto&    c = g_textCache;
+    STextKey key{style, constraints};
+
+    auto it = c.index.find(key);
+    if (it != c.index.end()) {
+        it->second->size = size;
+        c.lru.splice(c.lru.begin(), c.lru, it->second);
+        return;
+    }
+
+    c.lru.push_front(SEntry{key, size});
+    c.index.emplace(std::move(key), c.lru.begin());
+    c.bytes += entryBytes(c.lru.front().key);
+    evictOverBudget();
+}
+
+extern "C" {
+
+JNIEXPORT jdoubleArray JNICALL
+Java_org_hyprclj_bindings_Text_nativeMeasure(
+    JNIEnv* env, jclass clazz, jstring content, jint fontFamilyId, jint fontSize, jint maxWidth) {
+
+    const STextStyle style{CJniString(env, content).str(), internedString(fontFamilyId), (float)fontSize};
+    const Vector2D   constraints = {maxWidth < 0 ? std::numeric_limits<double>::max() : (double)maxWidth,
+                                    std::numeric_limits<double>::max()};
+
+    auto size = textCacheFind(style, constraints);
+    if (!size) {
+        try {
+            auto builder = g_probe ? g_probe->rebuild() : CTextBuilder::begin();
+            builder->text(std::string(style.content))->fontSize(CFontSize(CFontSize::HT_FONT_ABSOLUTE, style.size));
+            if (!style.font.empty()) {
+                builder->fontFamily(std::string(style.font));
+            }
+            auto probe = builder->commence();
+            if (!g_probe) g_probe = probe;
+        } catch (const std::exception& e) {
+            return nullptr;
+        }
+
+        size = g_probe->preferredSize(constraints).value_or(Vector2D{});
+        textCacheStore(style, constraints, *size);
+    }
+
+    const jdouble values[2] = {size->x, size->y};
+    jdoubleArray  result    = env->NewDoubleArray(2);
+    env->SetDoubleArrayRegion(result, 0, 2, values);
+    return result;
+}
+
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Text_nativeMeasureStats(JNIEnv* env, jclass clazz) {
+    const auto& c         = g_textCache;
+    const jlong values[6] = {(jlong)c.index.size(), (jlong)c.bytes, (jlong)c.budget,
+                             (jlong)c.hits,         (jlong)c.misses, (jlong)c.evictions};
+
+    jlongArray result = env->NewLongArray(6);
+    env->SetLongArrayRegion(result, 0, 6, values);
+    return result;
+}
+
+JNIEXPORT void JNICALL
+Java_org_hyprclj_bindings_Text_nativeSetMeasureCacheBudget(JNIEnv* env, jclass clazz, jlong bytes) {
+    if (bytes < 0) return;
+    g_textCache.budget = (size_t)bytes;
+    evictOverBudget();
+}
+
+} // extern "C"
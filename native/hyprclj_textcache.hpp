@@ -0,0 +1,15 @@
+#pragma once
+
+#include <hyprutils/math/Vector2D.hpp>
+#include <optional>
+
+#include "hyprclj_layout.hpp"
+
+// Text measurement cache (hyprclj_textcache.cpp)
+//
+// Measured sizes of text runs keyed by (content, font family, font size,
+// constraints), shared by every element showing the same text and by
+// Text.measure. LRU-evicted under a memory budget.
+
+std::optional<Hyprutils::Math::Vector2D> textCacheFind(const STextStyle& style, const Hyprutils::Math::Vector2D& constraints);
+void textCacheStore(const STextStyle& style, const Hyprutils::Math::Vector2D& constraints, const Hyprutils::Math::Vector2D& size);
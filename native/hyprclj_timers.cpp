@@ -0,0 +1,410 @@
+#include <jni.h>
+#include <hyprtoolkit/core/Backend.hpp>
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "hyprclj_timers.hpp"
+
+using namespace Hyprtoolkit;
+
+extern JavaVM* g_jvm;
+extern JNIEnv* getEnv();
+
+// Timers
+//
+// Java timers live in a hierarchical timing wheel driven by a single backend
+// timer, armed for the next tick that has work. Arming, cancelling and
+// expiring a timer are O(1) regardless of how many are pending.
+//
+// The wheel has 4 levels of 64 slots with a 1 ms tick: level 0 holds timers
+// due within 64 ms, level 1 within 4 s, level 2 within ~4.5 min, level 3
+// within ~4.6 h (later ones are parked there and re-placed). When the
+// current tick reaches the start of a higher-level slot, its timers are
+// cascaded down; a level-0 slot fires when its tick comes up. Per-level
+// occupancy bitmaps find the next slot with work without scanning.
+//
+// Coalescing: a timer with slack may fire up to slack ms late. Its expiry is
+// rounded up to a multiple of the largest power of two within the slack, so
+// periodic timers with similar slack line up on the same ticks and share
+// wakeups.
+//
+// Handles are (generation << 32 | index) into a slab of timer records, so a
+// stale handle can never cancel a recycled timer.
+//
+// Native timers (palette animations) live in the same wheel with a C++
+// callback instead of a Runnable, so they share its wakeups.
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int      LEVELS     = 4;
+constexpr int      SLOT_BITS  = 6;
+constexpr int      SLOTS      = 1 << SLOT_BITS;
+constexpr uint64_t SLOT_MASK  = SLOTS - 1;
+constexpr uint64_t MAX_DELTA  = (1ull << (SLOT_BITS * LEVELS)) - 1;
+constexpr int32_t  NIL        = -1;
+constexpr uint64_t NO_TICK    = UINT64_MAX;
+
+struct STimer {
+    jobject  callback = nullptr; // Runnable
+    uint64_t deadline = 0;       // requested tick (repeat base, no drift)
+    uint64_t expires  = 0;       // tick it fires at, after coalescing
+    uint32_t interval = 0;       // ms; 0 for one-shot
+    uint32_t slack    = 0;       // ms
+    uint32_t gen      = 1;
+    int32_t  prev = NIL, next = NIL;
+    int16_t  level = -1, slot = -1; // placement, -1 when not in the wheel
+    bool     active = false;
+
+    std::function<void()> native; // called instead of callback (native timers)
+};
+
+struct SWheel {
+    std::vector<STimer>  timers;
+    std::vector<int32_t> freeList;
+    int32_t              heads[LEVELS][SLOTS];
+    uint64_t             occupied[LEVELS] = {};
+
+    Clock::time_point    epoch = Clock::now();
+    uint64_t             current = 0; // last processed tick
+
+    Hyprutils::Memory::CSharedPointer<IBackend> backend;
+    ASP<CTimer>          driver;
+    uint64_t             driverTick = NO_TICK;
+    jmethodID            runMethod = nullptr;
+
+    uint64_t             wakeups = 0;
+    uint64_t             fired   = 0;
+    uint64_t             activeCount = 0;
+
+    SWheel() {
+        for (auto& level : heads) {
+            for (auto& head : level) head = NIL;
+        }
+    }
+};
+
+SWheel g_wheel;
+
+uint64_t nowTick() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - g_wheel.epoch).count();
+}
+
+void unlink(int32_t idx) {
+    auto& w = g_wheel;
+    auto& t = w.timers[idx];
+    if (t.level < 0) return;
+
+    if (t.prev != NIL) {
+        w.timers[t.prev].next = t.next;
+    } else {
+        w.heads[t.level][t.slot] = t.next;
+        if (t.next == NIL) {
+            w.occupied[t.level] &= ~(1ull << t.slot);
+        }
+    }
+    if (t.next != NIL) {
+        w.timers[t.next].prev = t.prev;
+    }
+    t.prev = t.next = NIL;
+    t.level = t.slot = -1;
+}
+
+void place(int32_t idx) {
+    auto& w = g_wheel;
+    auto& t = w.timers[idx];
+
+    // Park far-away timers at the top level; they are re-placed on cascade
+    uint64_t expires = t.expires;
+    if (expires > w.current + MAX_DELTA) {
+        expires = w.current + MAX_DELTA;
+    }
+    const uint64_t delta = expires > w.current ? expires - w.current : 0;
+
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (1ull << (SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+    const int slot = (int)((expires >> (SLOT_BITS * level)) & SLOT_MASK);
+
+    t.level = (int16_t)level;
+    t.slot  = (int16_t)slot;
+    t.prev  = NIL;
+    t.next  = w.heads[level][slot];
+    if (t.next != NIL) {
+        w.timers[t.next].prev = idx;
+    }
+    w.heads[level][slot] = idx;
+    w.occupied[level] |= 1ull << slot;
+}
+
+// Expiry after coalescing: round up to the largest power of two <= slack
+uint64_t coalesce(uint64_t deadline, uint32_t slack) {
+    if (slack < 2) return deadline;
+    const uint64_t grain = std::bit_floor((uint64_t)slack);
+    return (deadline + grain - 1) & ~(grain - 1);
+}
+
+// Tick at which the wheel next has work (a level-0 slot to fire or a
+// higher-level slot to cascade), or NO_TICK when empty
+uint64_t nextEventTick() {
+    auto&    w    = g_wheel;
+    uint64_t best = NO_TICK;
+
+    for (int level = 0; level < LEVELS; ++level) {
+        if (!w.occupied[level]) continue;
+
+        const int      shift = SLOT_BITS * level;
+        const uint64_t block = w.current >> shift;
+        // First occupied slot strictly after the current block, in rotation order
+        const int      from  = (int)((block + 1) & SLOT_MASK);
+        const int      step  = std::countr_zero(std::rotr(w.occupied[level], from));
+        const uint64_t tick  = (block + 1 + step) << shift;
+        best                 = std::min(best, tick);
+    }
+    return best;
+}
+
+// Return a fired or cancelled timer to the slab
+void freeTimer(JNIEnv* env, int32_t idx) {
+    auto& w = g_wheel;
+    auto& t = w.timers[idx];
+    if (t.callback) env->DeleteGlobalRef(t.callback);
+    t.callback = nullptr;
+    t.native   = nullptr;
+    t.active   = false;
+    t.gen++;
+    w.freeList.push_back(idx);
+    w.activeCount--;
+}
+
+void fire(JNIEnv* env, int32_t idx, uint32_t gen) {
+    auto& w = g_wheel;
+    auto& t = w.timers[idx];
+
+    // Cancelled (and maybe recycled) by an earlier callback in the batch
+    if (t.gen != gen || !t.active) return;
+
+    w.fired++;
+    if (t.native) {
+        // Copied out: the callback may add timers and grow the slab
+        auto fn = t.native;
+        fn();
+    } else {
+        env->CallVoidMethod(t.callback, w.runMethod);
+        if (env->ExceptionCheck()) {
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+        }
+    }
+
+    // The callback may have cancelled this timer (or grown the slab)
+    auto& after = w.timers[idx];
+    if (after.gen != gen || !after.active || after.level >= 0) return;
+
+    if (after.interval == 0) {
+        freeTimer(env, idx);
+        return;
+    }
+
+    // Repeat from the previous deadline; skip missed periods instead of bursting
+    after.deadline += after.interval;
+    if (after.deadline <= w.current) {
+        after.deadline = w.current + after.interval;
+    }
+    after.expires = coalesce(after.deadline, after.slack);
+    place(idx);
+}
+
+// Process one tick: cascade the higher-level slots starting here, then fire
+// the level-0 slot
+void processTick(JNIEnv* env, uint64_t tick) {
+    auto& w   = g_wheel;
+    w.current = tick;
+
+    for (int level = LEVELS - 1; level >= 1; --level) {
+        const int shift = SLOT_BITS * level;
+        if (tick & ((1ull << shift) - 1)) continue;
+
+        const int slot = (int)((tick >> shift) & SLOT_MASK);
+        int32_t   idx  = w.heads[level][slot];
+        w.heads[level][slot] = NIL;
+        w.occupied[level] &= ~(1ull << slot);
+        while (idx != NIL) {
+            const int32_t next = w.timers[idx].next;
+            w.timers[idx].level = w.timers[idx].slot = -1;
+            place(idx);
+            idx = next;
+        }
+    }
+
+    // Detach the due slot first: callbacks may add and cancel timers
+    const int slot = (int)(tick & SLOT_MASK);
+    std::vector<std::pair<int32_t, uint32_t>> due;
+    for (int32_t idx = w.heads[0][slot]; idx != NIL; idx = w.timers[idx].next) {
+        if (w.timers[idx].expires <= tick) due.emplace_back(idx, w.timers[idx].gen);
+    }
+    for (auto [idx, gen] : due) {
+        unlink(idx);
+    }
+    for (auto [idx, gen] : due) {
+        fire(env, idx, gen);
+    }
+}
+
+void onDriver();
+
+// Arm the backend timer for the next tick with work
+void rearm() {
+    auto& w    = g_wheel;
+    auto  next = nextEventTick();
+    if (next == w.driverTick) return;
+
+    if (w.driver) {
+        w.driver->cancel();
+        w.driver = {};
+    }
+    w.driverTick = next;
+    if (next == NO_TICK || !w.backend) return;
+
+    const uint64_t now   = nowTick();
+    const uint64_t delay = next > now ? next - now : 0;
+    w.driver = w.backend->addTimer(std::chrono::milliseconds(delay), [](auto timer, void* data) { onDriver(); },
+                                   nullptr, false);
+}
+
+// Run every tick with work up to now
+void advance(JNIEnv* env) {
+    auto&          w   = g_wheel;
+    const uint64_t now = nowTick();
+
+    for (uint64_t tick = nextEventTick(); tick <= now; tick = nextEventTick()) {
+        processTick(env, tick);
+    }
+    if (now > w.current) {
+        w.current = now;
+    }
+}
+
+void onDriver() {
+    auto& w      = g_wheel;
+    w.driver     = {};
+    w.driverTick = NO_TICK;
+    w.wakeups++;
+
+    advance(getEnv());
+    rearm();
+}
+
+int32_t allocTimer() {
+    auto& w = g_wheel;
+    if (!w.freeList.empty()) {
+        int32_t idx = w.freeList.back();
+        w.freeList.pop_back();
+        return idx;
+    }
+    w.timers.emplace_back();
+    return (int32_t)w.timers.size() - 1;
+}
+
+int32_t timerFor(jlong handle) {
+    const int32_t  idx = (int32_t)(handle & 0xFFFFFFFF);
+    const uint32_t gen = (uint32_t)((uint64_t)handle >> 32);
+    if (idx < 0 || idx >= (int32_t)g_wheel.timers.size()) return NIL;
+
+    const auto& t = g_wheel.timers[idx];
+    return t.gen == gen && t.active ? idx : NIL;
+}
+
+// Place a new timer; exactly one of callback and native is set
+jlong addTimer(const Hyprutils::Memory::CSharedPointer<IBackend>& backend, jint delayMs, jint intervalMs, jint slackMs,
+               jobject callback, std::function<void()> native) {
+    auto& w = g_wheel;
+    if (!w.backend) {
+        w.backend = backend;
+    }
+
+    // Catch the wheel up so the new timer is placed relative to now; due
+    // timers still fire from the driver, in order
+    const uint64_t now  = nowTick();
+    const uint64_t next = nextEventTick();
+    const uint64_t safe = next == NO_TICK ? now : std::min(now, next - 1);
+    if (safe > w.current) {
+        w.current = safe;
+    }
+
+    const int32_t idx = allocTimer();
+    auto&         t   = w.timers[idx];
+    t.callback        = callback;
+    t.native          = std::move(native);
+    t.interval        = intervalMs > 0 ? (uint32_t)intervalMs : 0;
+    t.slack           = slackMs > 0 ? (uint32_t)slackMs : 0;
+    t.deadline        = std::max(now + (uint64_t)std::max(delayMs, 0), w.current + 1);
+    t.expires         = coalesce(t.deadline, t.slack);
+    t.active          = true;
+    w.activeCount++;
+
+    place(idx);
+    rearm();
+    return (jlong)(((uint64_t)t.gen << 32) | (uint32_t)idx);
+}
+
+bool cancelTimer(JNIEnv* env, jlong handle) {
+    const int32_t idx = timerFor(handle);
+    if (idx == NIL) return false;
+
+    unlink(idx);
+    freeTimer(env, idx);
+    rearm();
+    return true;
+}
+
+} // namespace
+
+jlong timerAdd(const Hyprutils::Memory::CSharedPointer<IBackend>& backend, uint32_t delayMs, uint32_t slackMs,
+               std::function<void()> fn) {
+    if (!backend || !fn) return 0;
+    return addTimer(backend, (jint)delayMs, 0, (jint)slackMs, nullptr, std::move(fn));
+}
+
+bool timerCancel(jlong handle) {
+    return cancelTimer(getEnv(), handle);
+}
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL
+Java_org_hyprclj_bindings_Backend_nativeTimerAdd(
+    JNIEnv* env, jobject obj, jlong handle, jint delayMs, jint intervalMs, jint slackMs, jobject callback) {
+
+    auto backend = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IBackend>*>(handle);
+    if (!backend || !callback) return 0;
+
+    auto& w = g_wheel;
+    if (!w.runMethod) {
+        jclass runnableClass = env->FindClass("java/lang/Runnable");
+        w.runMethod          = env->GetMethodID(runnableClass, "run", "()V");
+    }
+    return addTimer(backend, delayMs, intervalMs, slackMs, env->NewGlobalRef(callback), nullptr);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_org_hyprclj_bindings_Backend_nativeTimerCancel(JNIEnv* env, jclass clazz, jlong timerHandle) {
+    return cancelTimer(env, timerHandle);
+}
+
+JNIEXPORT jlongArray JNICALL
+Java_org_hyprclj_bindings_Backend_nativeTimerStats(JNIEnv* env, jclass clazz) {
+    const auto& w        = g_wheel;
+    jlong       stats[3] = {(jlong)w.activeCount, (jlong)w.wakeups, (jlong)w.fired};
+
+    jlongArray result = env->NewLongArray(3);
+    env->SetLongArrayRegion(result, 0, 3, stats);
+    return result;
+}
+
+} // extern "C"
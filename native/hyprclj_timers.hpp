@@ -0,0 +1,19 @@
+#pragma once
+
+#include <jni.h>
+#include <hyprtoolkit/core/Backend.hpp>
+#include <cstdint>
+#include <functional>
+
+// Timers (hyprclj_timers.cpp)
+//
+// Native one-shot timers on the same timing wheel as Java's, so they share
+// its backend wakeups instead of arming backend timers of their own.
+
+// Run fn once after delayMs, up to slackMs late. Returns a handle for
+// timerCancel, 0 without a backend.
+jlong timerAdd(const Hyprutils::Memory::CSharedPointer<Hyprtoolkit::IBackend>& backend, uint32_t delayMs, uint32_t slackMs,
+               std::function<void()> fn);
+
+// Cancel a pending timer; false if it already fired or was cancelled
+bool timerCancel(jlong handle);
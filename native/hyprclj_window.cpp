@@ -4,6 +4,11 @@
 #include <hyprtoolkit/core/Backend.hpp>
 #include <hyprutils/math/Vector2D.hpp>
 #include <string>
+#include <unordered_map>
+
+#include "hyprclj_bitmap.hpp"
+#include "hyprclj_state.hpp"
+#include "hyprclj_strings.hpp"
 
 using namespace Hyprtoolkit;
 using Hyprutils::Math::Vector2D;
@@ -11,6 +16,17 @@ using Hyprutils::Math::Vector2D;
 extern JavaVM* g_jvm;
 extern JNIEnv* getEnv();
 
+// Keyboard listener, focus chain and key bindings (hyprclj_input.cpp)
+extern void inputForgetWindow(IWindow* window);
+
+namespace {
+
+// Keeps the bitmap cache rasterizing at the scale of the window last
+// opened or resized (the scale is only known once the surface is mapped)
+std::unordered_map<IWindow*, Hyprutils::Memory::CSharedPointer<Hyprutils::Signal::CSignalListener>> g_scaleListeners;
+
+} // namespace
+
 extern "C" {
 
 JNIEXPORT jlong JNICALL
@@ -21,13 +37,11 @@ Java_org_hyprclj_bindings_Window_00024Builder_nativeCreate(
     jint maxWidth, jint maxHeight) {
 
     try {
-        const char* titleChars = env->GetStringUTFChars(title, nullptr);
-        std::string titleStr(titleChars);
-        env->ReleaseStringUTFChars(title, titleChars);
+        const CJniString titleStr(env, title);
 
         auto builder = CWindowBuilder::begin();
 
-        builder->appTitle(std::move(titleStr));
+        builder->appTitle(titleStr.str());
         builder->preferredSize({(double)width, (double)height});
 
         if (minWidth > 0 && minHeight > 0) {
@@ -91,6 +105,10 @@ Java_org_hyprclj_bindings_Window_nativeOpen(JNIEnv* env, jobject obj, jlong hand
     auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
     if (window) {
         window->open();
+
+        IWindow* raw          = window.get();
+        g_scaleListeners[raw] = window->m_events.resized.listen([raw](const Vector2D&) { bitmapSetScale(raw->scale()); });
+        bitmapSetScale(window->scale());
     }
 }
 
@@ -98,6 +116,9 @@ JNIEXPORT void JNICALL
 Java_org_hyprclj_bindings_Window_nativeClose(JNIEnv* env, jobject obj, jlong handle) {
     auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
     if (window) {
+        g_scaleListeners.erase(window.get());
+        stateForgetWindow(window.get());
+        inputForgetWindow(window.get());
         window->close();
     }
 }
@@ -153,41 +174,7 @@ Java_org_hyprclj_bindings_Window_nativeSetResizeCallback(
     new Hyprutils::Memory::CSharedPointer<Hyprutils::Signal::CSignalListener>(resizeListener);
 }
 
-JNIEXPORT void JNICALL
-Java_org_hyprclj_bindings_Window_nativeSetKeyboardCallback(
-    JNIEnv* env, jobject obj, jlong handle, jobject listener) {
-
-    auto window = *reinterpret_cast<Hyprutils::Memory::CSharedPointer<IWindow>*>(handle);
-    if (!window) return;
-
-    jobject globalListener = env->NewGlobalRef(listener);
-
-    // Wire up keyboard event
-    auto keyboardListener = window->m_events.keyboardKey.listen([globalListener](const Input::SKeyboardKeyEvent& event) {
-        // Debug: Log that we received a keyboard event
-        printf("[C++] Keyboard event: keysym=%d down=%d utf8='%s'\n",
-               event.xkbKeysym, event.down, event.utf8.c_str());
-        fflush(stdout);
-
-        JNIEnv* env = getEnv();
-
-        // Call Java listener with full event data
-        jclass listenerClass = env->FindClass("org/hyprclj/bindings/Window$KeyboardListener");
-        jmethodID onKeyMethod = env->GetMethodID(listenerClass, "onKey", "(IZLjava/lang/String;I)V");
-
-        jstring utf8 = env->NewStringUTF(event.utf8.c_str());
-        env->CallVoidMethod(globalListener, onKeyMethod,
-                           (jint)event.xkbKeysym,
-                           (jboolean)event.down,
-                           utf8,
-                           (jint)event.modMask);
-        env->DeleteLocalRef(utf8);
-    });
-
-    // Store listener to prevent it from being destroyed
-    // (We should track this properly, but for POC just leak it)
-    new Hyprutils::Memory::CSharedPointer<Hyprutils::Signal::CSignalListener>(keyboardListener);
-}
+// Keyboard callback, focus chain and key dispatch live in hyprclj_input.cpp
 
 } // extern "C"
 
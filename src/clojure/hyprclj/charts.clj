@@ -2,7 +2,7 @@
   "Declarative chart generation - data to visual.
 
    Provides helper functions to create charts and graphs from raw data
-   using the native Line and Rectangle primitives."
+   using the native Line and Rectangle primitives, or a single Canvas."
   (:require [hyprclj.elements :as el]
             [hyprclj.dsl :as dsl]))
 
@@ -161,6 +161,35 @@
 
 ;; ===== Multi-line Chart =====
 
+(defn chart-commands
+  "Canvas commands for a chart: background, grid, axes and one polyline
+   per series, all in one display list.
+
+   Props: as multi-line-chart.
+
+   Example:
+     (el/set-canvas-commands! chart
+       (chart-commands {:series [{:data new-data}] :width 400 :height 300}))"
+  [{:keys [series width height background grid axes]}]
+  (let [{:keys [rows cols color] :or {rows 5 cols 5 color [200 200 200 60]}} grid
+        axis-color (if (vector? axes) axes [200 200 200 200])]
+    (concat
+      (when background
+        [[:rect 0 0 width height background]])
+      (when grid
+        (concat
+          (for [i (range 1 rows)]
+            [:rect 0 (* i (/ height rows)) width 1 color])
+          (for [i (range 1 cols)]
+            [:rect (* i (/ width cols)) 0 1 height color])))
+      (when axes
+        [[:rect 0 (dec height) width 1 axis-color]
+         [:rect 0 0 1 height axis-color]])
+      (for [{:keys [data color thick] :or {color [100 150 255 255] thick 2}} series
+            :when (seq data)]
+        [:polyline (map (fn [[x y]] [(* x width) (* y height)]) (data->line-points data))
+         color thick]))))
+
 (defn multi-line-chart
   "Create a chart with multiple data series.
 
@@ -168,6 +197,10 @@
      :series - Vector of {:data [...] :color [r g b a] :thick n} maps
      :width, :height - Chart dimensions
      :background - Optional background color
+     :grid - Optional {:rows n :cols n :color [r g b a]} grid lines
+     :axes - Optional true or axis color [r g b a]
+     :cache-as-bitmap - Rasterize the chart once and show it as one image
+                        until it changes (for static charts)
      :margin - Optional margin
 
    Example:
@@ -178,29 +211,20 @@
                  {:data [3 8 12 9 14 11]
                   :color [100 100 255 255]
                   :thick 2}]
+        :grid {:rows 4 :cols 6}
         :width 400
         :height 300})
 
-   NOTE: Multi-line charts are rendered programmatically to enable proper layering.
-   Returns a compiled element, not hiccup."
-  [{:keys [series width height background margin]
-    :or {margin 0}}]
+   The whole chart is one native canvas element drawn from a single
+   display list (see chart-commands). Returns a compiled element, not hiccup."
+  [{:keys [series width height margin cache-as-bitmap]
+    :or {margin 0}
+    :as props}]
   (when (seq series)
-    ;; Create a container to hold all layers - use row with gap 0
-    ;; and position each line absolutely to layer them
-    (let [container (el/rectangle {:color [0 0 0 0]  ; Transparent container
-                                    :size [width height]
-                                    :margin margin})]
-      ;; Add each line as a child with absolute positioning
-      (doseq [{:keys [data color thick] :or {thick 2}} series]
-        (when (seq data)
-          (let [points (data->line-points data)
-                line-elem (el/line {:points points :color color :thick thick :size [width height]})]
-            ;; Set absolute positioning so lines overlap instead of stacking
-            (el/set-position-mode! line-elem 0)       ; 0 = HT_POSITION_ABSOLUTE
-            (el/set-absolute-position! line-elem 0 0) ; Position at (0,0)
-            (el/add-child! container line-elem))))
-      container)))
+    (el/canvas {:size [width height]
+                :margin margin
+                :cache-as-bitmap cache-as-bitmap
+                :commands (chart-commands props)})))
 
 ;; ===== Helper: Add Grid Lines =====
 
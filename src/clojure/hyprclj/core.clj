@@ -2,7 +2,7 @@
   "Core functionality for Hyprtoolkit Clojure bindings.
    Provides backend and window management."
   (:require [hyprclj.elements :as elem])
-  (:import [org.hyprclj.bindings Backend Window]))
+  (:import [org.hyprclj.bindings Backend Backend$Task Backend$FdHandler Window]))
 
 ;; Backend management
 (defonce ^:private backend-atom (atom nil))
@@ -22,27 +22,187 @@
       (throw (ex-info "Backend not initialized. Call create-backend! first." {}))))
 
 (defn add-timer!
-  "Add a timer that fires after the specified milliseconds.
+  "Add a one-shot timer that fires after the specified milliseconds.
+   Returns a handle for cancel-timer!.
 
    Args:
      timeout-ms - Timeout in milliseconds
      callback   - Function to call when timer fires
 
+   Options:
+     :slack - Milliseconds the timer may fire late (default 0). Timers
+              with slack are coalesced so they share loop wakeups.
+
    Example:
-     (add-timer! 1000 #(println \"One second elapsed\"))"
-  [timeout-ms callback]
-  (.addTimer (get-backend) timeout-ms callback))
+     (add-timer! 1000 #(println \"One second elapsed\"))
+     (add-timer! 5000 save-draft! {:slack 250})"
+  ([timeout-ms callback]
+   (add-timer! timeout-ms callback nil))
+  ([timeout-ms callback {:keys [slack] :or {slack 0}}]
+   (.addTimer (get-backend) (int timeout-ms) 0 (int slack) callback)))
+
+(defn set-interval!
+  "Run callback every interval-ms milliseconds, starting one interval
+   from now. Runs keep to the original schedule (no drift); periods
+   missed while the loop was busy are skipped, not replayed.
+   Returns a handle for cancel-timer!.
+
+   Options:
+     :delay - Milliseconds before the first run (default interval-ms)
+     :slack - Milliseconds each run may fire late (default 0)
+
+   Example:
+     (def ticker (set-interval! 1000 #(swap! elapsed inc)))
+     (cancel-timer! ticker)"
+  ([interval-ms callback]
+   (set-interval! interval-ms callback nil))
+  ([interval-ms callback {:keys [delay slack] :or {slack 0}}]
+   (.addTimer (get-backend) (int (or delay interval-ms)) (int interval-ms) (int slack) callback)))
+
+(defn cancel-timer!
+  "Cancel a timer returned by add-timer! or set-interval!.
+   Returns true if it was still pending. Safe to call from inside the
+   timer's own callback and with stale handles."
+  [timer]
+  (.cancelTimer (get-backend) (long timer)))
+
+(defn timer-stats
+  "Timer wheel statistics.
+   Returns {:active n :wakeups n :fired n} - wakeups counts loop wakeups
+   for timers, so fired/wakeups shows how well timers coalesce."
+  []
+  (let [[active wakeups fired] (.timerStats (get-backend))]
+    {:active active :wakeups wakeups :fired fired}))
 
 (defn add-idle!
   "Add a callback that runs after pending events.
 
+   Idle callbacks run in FIFO order from a single native idle queue,
+   within a per-drain budget (see set-idle-budget!).
+
    Args:
      callback - Function to call when idle
 
+   Options:
+     :key - Key from idle-key. While a callback with this key is still
+            queued it is replaced by this one, so bursts of requests for
+            the same work run once.
+
+   Example:
+     (add-idle! #(println \"System is idle\"))
+
+     (def remount-key (idle-key))
+     (add-idle! remount! {:key remount-key})"
+  ([callback]
+   (.addIdle (get-backend) callback))
+  ([callback {:keys [key]}]
+   (.addIdle (get-backend) (long (or key 0)) callback)))
+
+(defn idle-key
+  "Allocate a fresh deduplication key for add-idle!."
+  []
+  (Backend/newIdleKey))
+
+(defn set-idle-budget!
+  "Set how long one idle drain may run before yielding to the event
+   loop; the rest runs on the next idle. Default 8ms."
+  [budget-ms]
+  (.setIdleBudget (get-backend) budget-ms))
+
+(def ^:private fd-event-bits
+  {:readable Backend/FD_READABLE
+   :hangup   Backend/FD_HANGUP
+   :error    Backend/FD_ERROR})
+
+(defn add-fd!
+  "Watch a file descriptor in the event loop. callback runs on the UI
+   thread as soon as the fd is ready - data arrives at the latency of its
+   source, and idle apps don't wake up to poll.
+
+   Hangups and errors are always reported, after which the watch is
+   removed; drain the fd when :hangup is in the event set.
+
+   Args:
+     fd       - File descriptor (int), owned by the caller
+     callback - (fn [fd events]) where events is a set of :readable,
+                :hangup, :error
+
+   Returns true, or false if the fd is invalid or already watched.
+
    Example:
-     (add-idle! #(println \"System is idle\"))"
+     (add-fd! fd (fn [fd events]
+                   (when (:readable events)
+                     (read-samples! fd))))"
+  [fd callback]
+  (.addFd (get-backend) (int fd) Backend/FD_READABLE
+          (reify Backend$FdHandler
+            (onReady [_ fd events]
+              (callback fd (into #{}
+                                 (keep (fn [[k bit]]
+                                         (when (pos? (bit-and events bit)) k)))
+                                 fd-event-bits))))))
+
+(defn remove-fd!
+  "Stop watching a file descriptor. Does not close it.
+   Returns true if the fd was watched."
+  [fd]
+  (.removeFd (get-backend) (int fd)))
+
+(defn post!
+  "Run a callback on the UI (event loop) thread.
+
+   Unlike add-idle!, this is safe to call from any thread. Posted
+   callbacks run in FIFO order, batched into one loop wakeup.
+
+   Example:
+     (future
+       (let [data (fetch-data)]
+         (post! #(reset! app-state data))))"
   [callback]
-  (.addIdle (get-backend) callback))
+  (.post (get-backend) callback))
+
+(def ^:private scheduler-lanes
+  {:input Backend/LANE_INPUT
+   :timer Backend/LANE_TIMER
+   :idle  Backend/LANE_IDLE})
+
+(defn schedule!
+  "Schedule resumable work on the native frame scheduler.
+
+   task-fn is called once per frame slice. It should do a bounded amount
+   of work, checking (should-yield?) as it goes, and return truthy to be
+   resumed on the next frame or falsy once it is finished.
+
+   Lanes run in priority order: :input, then :timer, then :idle (default),
+   so input-driven work is never stuck behind a long idle job.
+
+   Example:
+     (let [pending (atom (range 10000))]
+       (schedule! (fn []
+                    (loop []
+                      (when-let [x (first @pending)]
+                        (process! x)
+                        (swap! pending rest)
+                        (if (should-yield?) true (recur)))))))"
+  ([task-fn]
+   (schedule! :idle task-fn))
+  ([lane task-fn]
+   (.schedule (get-backend)
+              (scheduler-lanes lane Backend/LANE_IDLE)
+              (reify Backend$Task
+                (run [_] (boolean (task-fn)))))))
+
+(defn should-yield?
+  "True when the running scheduler slice has used up its frame budget.
+   Always false outside scheduled work."
+  []
+  (.shouldYield (get-backend)))
+
+(defn set-frame-budget!
+  "Set how long scheduled work may run per frame, and the frame interval
+   used to resume yielded work. Defaults are 8ms of a 16ms frame."
+  [budget-ms interval-ms]
+  (.setFrameBudget (get-backend) budget-ms interval-ms))
 
 (defn enter-loop!
   "Enter the event loop. This blocks until the application exits.
@@ -92,9 +252,31 @@
   (.close window))
 
 (defn window-size
-  "Get the current window size as [width height]."
-  [window]
-  (vec (.getSize window)))
+  "Get the current window size as [width height].
+   Read from the window's state page - no native call. Both values come
+   from the same update (seqlocked read), never one from a resize in
+   progress."
+  [^Window window]
+  (let [out (int-array 2)]
+    (.size (.state window) out)
+    [(aget out 0) (aget out 1)]))
+
+(defn window-state
+  "Shared state page of a window (org.hyprclj.bindings.WindowState),
+   updated natively. Reads are plain memory loads - safe to poll.
+
+   Example:
+     (let [st (window-state window)]
+       (.width st) (.height st) (.modifiers st) (.focusedHandle st))"
+  [^Window window]
+  (.state window))
+
+(defn register-scroll-area!
+  "Publish a scroll area's offsets in the window state page.
+   Returns the slot to read with (.scrollX st slot) / (.scrollY st slot),
+   or -1 if all slots are taken."
+  [^Window window scroll-area]
+  (.registerScrollArea window scroll-area))
 
 (defn root-element
   "Get the root element of a window.
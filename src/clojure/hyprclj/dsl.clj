@@ -72,6 +72,144 @@
           (el/add-child! parent compiled)))))
   parent)
 
+(defn parse-spec
+  "Split a Hiccup spec into [tag props children].
+
+   Props are returned the way element constructors expect them: the
+   :children prop (when present) replaces positional children and is
+   removed from props, and color props are normalized to [r g b a].
+
+   Example:
+     (parse-spec [:text {:color \"#FFF\"} \"Hi\"])
+     => [:text {:color [255 255 255 255]} [\"Hi\"]]"
+  [spec]
+  (let [[tag & args] spec
+        ;; Check if first item after tag is a props map
+        [props children] (if (and (seq args) (map? (first args)))
+                           [(first args) (vec (clojure.core/rest args))]
+                           [{} (vec args)])
+        ;; Support :children prop - if present, use it instead of rest args
+        final-children (if (:children props)
+                         (:children props)
+                         children)
+        ;; Remove :children from props before passing to element constructors
+        ;; Also normalize any color properties (hex strings -> [r g b a] vectors),
+        ;; unless the html macro already did so at compile time
+        final-props (cond-> (dissoc props :children)
+                      (not (::normalized (meta props))) normalize-colors)]
+    [tag final-props final-children]))
+
+(defn expand-spec
+  "Expand custom and function components until the spec's tag is a
+   built-in element keyword. Non-vector values are returned unchanged.
+
+   Example:
+     (defn greeting [props] [:text (str \"Hi \" (:name props))])
+     (expand-spec [greeting {:name \"Ann\"}])
+     => [:text \"Hi Ann\"]"
+  [spec]
+  (loop [spec spec]
+    (if (vector? spec)
+      (let [tag (first spec)
+            component-fn (cond
+                           (and (keyword? tag) (@components tag)) (@components tag)
+                           (fn? tag) tag)]
+        (if component-fn
+          (let [[_ props children] (parse-spec spec)]
+            (recur (apply component-fn props (vec children))))
+          spec))
+      spec)))
+
+(defn- create-node [tag props]
+  (case tag
+    :button (el/button props)
+    :colored-button (ls/colored-button props)
+    :text (el/text props)
+    :textbox (el/textbox props)
+    :checkbox (el/checkbox props)
+    :rectangle (el/rectangle props)
+    :scroll-area (el/scroll-area props)
+    :scrollable (el/scroll-area props)  ; Alias
+    :column (el/column-layout props)
+    :row (el/row-layout props)
+    :flex (el/flex props)
+    :grid (el/grid props)
+    :canvas (el/canvas props)
+    ;; NEW Re-com style layout with positioning support
+    :v-box (ls/v-box props)
+    :h-box (ls/h-box props)
+    :box (ls/box props)
+    ;; OLD re-com compatibility
+    :v-box-old (layout/v-box props)
+    :h-box-old (layout/h-box props)
+    :box-old (layout/box props)
+    :gap (layout/gap props)
+    :spacer (layout/spacer props)
+    ;; Line: distinguish between drawing line (with :points) and layout separator
+    :line (if (:points props)
+            (el/line props)  ; Drawing primitive
+            (layout/line (:direction props :horizontal) props))  ; Layout separator
+    ;; Default: try as text
+    (el/text {:content (str tag)})))
+
+(defn- apply-event-props!
+  "Event delegation props, valid on any tag:
+     :on-event      - (fn [tag kind x y button]) for tagged descendants
+     :event-kinds   - Kinds delegated (default [:press])
+     :event-buttons - Buttons delegated (default :any)
+     :event-tag     - Integer tag reported to the delegating ancestor"
+  [element {:keys [on-event event-kinds event-buttons event-tag]}]
+  (when (and element on-event)
+    (el/delegate-events! element on-event
+                         {:kinds (or event-kinds [:press])
+                          :buttons (or event-buttons :any)}))
+  (when (and element event-tag)
+    (el/set-event-tag! element event-tag)))
+
+(defn- apply-flex-props!
+  "Flex item props, valid on any tag inside a :flex / :v-box / :h-box:
+     :flex-grow   - Share of free space
+     :flex-shrink - Share of overflow to give back
+     :flex-basis  - Main-axis size before growing
+     :align-self  - Cross-axis alignment overriding the container's
+     :min-size    - [width height] lower bound in px
+     :max-size    - [width height] upper bound in px"
+  [element {:keys [flex-grow flex-shrink flex-basis align-self min-size max-size]}]
+  (when (and element (or flex-grow flex-shrink flex-basis align-self))
+    (el/set-flex-item! element (cond-> {}
+                                 flex-grow (assoc :grow flex-grow)
+                                 flex-shrink (assoc :shrink flex-shrink)
+                                 flex-basis (assoc :basis flex-basis)
+                                 align-self (assoc :align align-self))))
+  (when (and element (or min-size max-size))
+    (el/set-size-constraints! element {:min min-size :max max-size})))
+
+(defn- apply-grid-props!
+  "Grid cell props, valid on any tag inside a :grid:
+     :grid-row    - Row index
+     :grid-column - Column index
+     :row-span    - Rows covered
+     :col-span    - Columns covered"
+  [element {:keys [grid-row grid-column row-span col-span]}]
+  (when (and element (or grid-row grid-column row-span col-span))
+    (el/set-grid-cell! element (cond-> {}
+                                 grid-row (assoc :row grid-row)
+                                 grid-column (assoc :column grid-column)
+                                 row-span (assoc :row-span row-span)
+                                 col-span (assoc :col-span col-span)))))
+
+(defn compile-node
+  "Create the native element for a built-in tag, without its children.
+
+   Used by compile-element and by the VDOM reconciler, which adds
+   children itself so it can build large trees incrementally."
+  [tag props]
+  (let [element (create-node tag props)]
+    (apply-event-props! element props)
+    (apply-flex-props! element props)
+    (apply-grid-props! element props)
+    element))
+
 (defn compile-element
   "Compile a Hiccup-style element specification into a native element.
 
@@ -89,20 +227,7 @@
        [:text \"Line 2\"]]"
   [spec]
   (when (vector? spec)
-    (let [[tag & args] spec
-          ;; Check if first item after tag is a props map
-          [props children] (if (and (seq args) (map? (first args)))
-                             [(first args) (vec (clojure.core/rest args))]
-                             [{} (vec args)])
-          ;; Support :children prop - if present, use it instead of rest args
-          final-children (if (:children props)
-                          (:children props)
-                          children)
-          ;; Remove :children from props before passing to element constructors
-          ;; Also normalize any color properties (hex strings -> [r g b a] vectors)
-          final-props (-> props
-                          (dissoc :children)
-                          normalize-colors)]
+    (let [[tag final-props final-children] (parse-spec spec)]
 
       (cond
         ;; Custom component from registry
@@ -116,33 +241,7 @@
 
         ;; Built-in elements
         :else
-        (let [element (case tag
-                        :button (el/button final-props)
-                        :colored-button (ls/colored-button final-props)
-                        :text (el/text final-props)
-                        :textbox (el/textbox final-props)
-                        :checkbox (el/checkbox final-props)
-                        :rectangle (el/rectangle final-props)
-                        :scroll-area (el/scroll-area final-props)
-                        :scrollable (el/scroll-area final-props)  ; Alias
-                        :column (el/column-layout final-props)
-                        :row (el/row-layout final-props)
-                        ;; NEW Re-com style layout with positioning support
-                        :v-box (ls/v-box final-props)
-                        :h-box (ls/h-box final-props)
-                        :box (ls/box final-props)
-                        ;; OLD re-com compatibility
-                        :v-box-old (layout/v-box final-props)
-                        :h-box-old (layout/h-box final-props)
-                        :box-old (layout/box final-props)
-                        :gap (layout/gap final-props)
-                        :spacer (layout/spacer final-props)
-                        ;; Line: distinguish between drawing line (with :points) and layout separator
-                        :line (if (:points final-props)
-                                (el/line final-props)  ; Drawing primitive
-                                (layout/line (:direction final-props :horizontal) final-props))  ; Layout separator
-                        ;; Default: try as text
-                        (el/text {:content (str tag)}))]
+        (let [element (compile-node tag final-props)]
 
           ;; Add children
           (when (seq final-children)
@@ -235,12 +334,120 @@
   `(defn ~name ~args
      ~@body))
 
+;; ===== Compiled templates =====
+;;
+;; html analyzes Hiccup at macroexpansion time instead of on every render:
+;; fully static subtrees are hoisted into constants (so the VDOM sees the
+;; identical vector every render and keeps the element without diffing it),
+;; and literal colors are normalized once, at compile time.
+
+(def ^:private color-keys [:color :background :bg-color :border-color])
+
+(defn- static-form?
+  "True when a form contains no code - only literals and collections of
+   literals (including their metadata, e.g. ^{:key ...}) - so it evaluates
+   to the same value on every call."
+  [form]
+  (cond
+    (or (nil? form) (string? form) (number? form) (keyword? form)
+        (boolean? form) (char? form)) true
+    (map? form) (and (static-form? (meta form))
+                     (every? static-form? (keys form))
+                     (every? static-form? (vals form)))
+    (or (vector? form) (set? form)) (and (static-form? (meta form))
+                                         (every? static-form? form))
+    :else false))
+
+(defn- hiccup-form?
+  "True for a literal Hiccup vector with a built-in (keyword) tag."
+  [form]
+  (and (vector? form) (keyword? (first form))))
+
+(defn- compile-props
+  "Normalize colors in a literal props map at compile time. Dynamic color
+   values get a runtime normalize-color call in place. Flags the map as
+   normalized so parse-spec skips it."
+  [props]
+  (let [props (reduce (fn [m k]
+                        (let [c (get m k)]
+                          (cond
+                            (nil? c) m
+                            (static-form? c) (assoc m k (color/normalize-color c))
+                            :else (assoc m k `(some-> ~c color/normalize-color)))))
+                      props
+                      color-keys)]
+    (vary-meta props assoc ::normalized true)))
+
+(defn- compile-node-form
+  "Rebuild a Hiccup node form with compiled props and children,
+   keeping its metadata (^{:key ...})."
+  [form compile-child]
+  (let [[tag & args] form
+        has-props? (map? (first args))
+        children (map compile-child (if has-props? (rest args) args))]
+    (with-meta (into (if has-props? [tag (compile-props (first args))] [tag]) children)
+               (meta form))))
+
+(defn- normalize-static
+  "Compile-time normalization of a static Hiccup subtree (returns data)."
+  [form]
+  (if (hiccup-form? form)
+    (compile-node-form form normalize-static)
+    form))
+
+(defn compile-template
+  "Compile a literal Hiccup form into code that builds the same Hiccup.
+   Static subtrees become quoted constants; dynamic nodes keep their
+   shape with pre-normalized props and compiled children. Non-Hiccup
+   forms (function calls, symbols, `for` etc.) are left untouched.
+
+   Example:
+     (compile-template '[:text {:color \"#FFF\"} \"Hi\"])
+     => '(quote [:text {:color [255 255 255 255]} \"Hi\"])"
+  [form]
+  (cond
+    (not (hiccup-form? form)) form
+    (static-form? form) (list 'quote (normalize-static form))
+    :else (compile-node-form form compile-template)))
+
+(defmacro html
+  "Compile a Hiccup template at macroexpansion time.
+
+   Returns the same Hiccup data as the literal would, but:
+   - fully static subtrees are built once and returned as the identical
+     constant on every call, so the VDOM keeps them without diffing
+   - literal colors are parsed once, at compile time
+   Re-render cost then scales with the dynamic parts of the template.
+
+   Hiccup nested inside code (e.g. in a `for`) needs its own html.
+
+   Example:
+     (html
+       [:v-box {:gap 10}
+         [:text {:color \"#888\"} \"Static header\"]   ; hoisted
+         [:text (str \"Count: \" (:count state))]])"
+  [form]
+  (compile-template form))
+
+(defmacro defui
+  "Define a component whose returned Hiccup is compiled with html.
+
+   Example:
+     (defui counter-view [state]
+       [:v-box {}
+         [:text {:color \"#FFF\"} \"Counter\"]
+         [:text (str (:count state))]])"
+  [name args & body]
+  `(defn ~name ~args
+     ~@(butlast body)
+     (html ~(last body))))
+
 ;; Reactive component wrapper
 (defn reactive
-  "Make a component reactive to atom changes.
+  "Make a component reactive to ratom/reaction changes.
 
    Example:
-     (def counter (atom 0))
+     (def counter (ratom 0))
      (reactive
        (fn []
          [:text {:content (str \"Count: \" @counter)}]))"
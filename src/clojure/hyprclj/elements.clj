@@ -1,6 +1,8 @@
 (ns hyprclj.elements
   "UI element constructors and utilities."
-  (:import [org.hyprclj.bindings Element Button Text ColumnLayout RowLayout Textbox Checkbox Rectangle ScrollArea Line]))
+  (:import [org.hyprclj.bindings Element Element$MouseHandler Element$DelegateHandler Button Text ColumnLayout RowLayout
+            Textbox Checkbox Checkbox$ToggleHandler Rectangle ScrollArea Line Flex Grid Size
+            Canvas DisplayList Columns]))
 
 ;; Element utilities
 (defn add-child!
@@ -55,19 +57,60 @@
     (.setAlign element (name align)))
   element)
 
+(defn size-spec
+  "Encode one axis of a size for the native side.
+   Accepts:
+     400              ; pixels
+     -1 or :auto      ; sized by content
+     :fill            ; fill the parent
+     \"50%\"            ; percent of the parent
+     [:percent 50]    ; same
+
+   Percent and fill sizes are resolved natively on every relayout, so
+   they follow window resizes without a re-render."
+  [spec]
+  (cond
+    (nil? spec) Size/AUTO
+    (number? spec) (if (neg? spec) Size/AUTO (Size/px (int spec)))
+    (= spec :auto) Size/AUTO
+    (= spec :fill) Size/FILL
+    (string? spec) (if (.endsWith ^String spec "%")
+                     (Size/percent (Double/parseDouble (subs spec 0 (dec (count spec)))))
+                     (throw (ex-info "Invalid size spec" {:spec spec})))
+    (and (vector? spec) (= :percent (first spec))) (Size/percent (double (second spec)))
+    :else (throw (ex-info "Invalid size spec" {:spec spec}))))
+
 (defn set-size!
   "Set the size of an element.
    Can be called with:
      (set-size! el 400 300)           ; width height
      (set-size! el [400 300])         ; [width height]
-   Use -1 for auto-sizing in either dimension."
+     (set-size! el \"50%\" :fill)       ; see size-spec
+   Use -1 or :auto for auto-sizing in either dimension."
   ([element size-vec]
    (let [[w h] size-vec]
      (set-size! element w h)))
   ([element width height]
-   (.setSize element width height)
+   (.setSize element (size-spec width) (size-spec height))
    element))
 
+(defn set-size-constraints!
+  "Set minimum and maximum sizes in pixels, honoured by native containers
+   (flex, v-box, h-box). Omitted or -1 axes are unconstrained.
+
+   Options:
+     :min - [width height]
+     :max - [width height]
+
+   Example:
+     (set-size-constraints! sidebar {:min [160 -1] :max [320 -1]})"
+  [element {:keys [min max]}]
+  (let [[min-w min-h] min
+        [max-w max-h] max]
+    (.setSizeConstraints element (int (or min-w -1)) (int (or min-h -1))
+                         (int (or max-w -1)) (int (or max-h -1)))
+    element))
+
 (defn set-position-mode!
   "Set position mode for an element.
    Modes:
@@ -89,18 +132,228 @@
    (.setAbsolutePosition element x y)
    element))
 
+(def ^:private mouse-kinds
+  [:press :release :enter :leave :move :double-click])
+
+(def ^:private mouse-kind-bits
+  (zipmap mouse-kinds (map #(bit-shift-left 1 %) (range))))
+
+(def ^:private mouse-button-bits
+  {:left Element/BUTTON_LEFT
+   :right Element/BUTTON_RIGHT
+   :middle Element/BUTTON_MIDDLE
+   :other Element/BUTTON_OTHER
+   :any Element/BUTTON_ANY})
+
+(defn- mask [bits ks]
+  (reduce (fn [m k]
+            (bit-or m (or (bits k)
+                          (throw (IllegalArgumentException. (str "Unknown mouse option: " k))))))
+          0 (if (keyword? ks) [ks] ks)))
+
+(defn set-mouse-handler!
+  "Set one handler for an element's mouse events, called with
+   (kind x y button) where kind is :press, :release, :enter, :leave or
+   :move. Events arrive as primitives - nothing is allocated natively.
+
+   Options:
+     :move? - Also deliver :move events (default false)
+
+   Example:
+     (set-mouse-handler! el
+       (fn [kind x y button]
+         (when (= kind :press) (println \"Pressed at\" x y))))"
+  ([element handler-fn]
+   (set-mouse-handler! element handler-fn {}))
+  ([^Element element handler-fn {:keys [move?]}]
+   (.setMouseHandler element
+     (reify Element$MouseHandler
+       (onMouse [_ x y button kind]
+         (handler-fn (nth mouse-kinds kind) x y button)))
+     (boolean move?))
+   element))
+
+(defn on-mouse!
+  "Subscribe handler-fn to some mouse events of an element. Filtering
+   happens natively - Java is only entered for matching events.
+   handler-fn is called with (kind x y button).
+
+   Args:
+     kinds   - Event kind or kinds: :press :release :double-click
+               :enter :leave :move
+     buttons - Button or buttons for button kinds: :left :right
+               :middle :other :any (default :any)
+
+   Returns a subscription id for off-mouse!.
+
+   Example:
+     (on-mouse! el :double-click (fn [_ x y _] (println \"Double at\" x y)))
+     (on-mouse! el [:press :release] [:middle] handler)"
+  ([element kinds handler-fn]
+   (on-mouse! element kinds :any handler-fn))
+  ([^Element element kinds buttons handler-fn]
+   (.addMouseListener element
+     (int (mask mouse-kind-bits kinds))
+     (int (mask mouse-button-bits buttons))
+     (reify Element$MouseHandler
+       (onMouse [_ x y button kind]
+         (handler-fn (nth mouse-kinds kind) x y button))))))
+
+(defn off-mouse!
+  "Remove a subscription returned by on-mouse!."
+  [^Element element id]
+  (.removeMouseListener element (int id)))
+
+(defn delegate-events!
+  "Handle the mouse events of every tagged descendant of a container with
+   one handler, called with (tag kind x y button). Descendants carry an
+   integer tag (set-event-tag! or the :event-tag prop) instead of their
+   own handlers, so a long list costs one handler, not one per row.
+
+   Options:
+     :kinds   - Event kinds (default [:press])
+     :buttons - Buttons for button kinds (default :any)
+
+   Example:
+     (delegate-events! list
+       (fn [tag kind _ _ _] (remove-todo! tag))
+       {:kinds [:press] :buttons :left})"
+  ([element handler-fn]
+   (delegate-events! element handler-fn {}))
+  ([^Element element handler-fn {:keys [kinds buttons] :or {kinds [:press] buttons :any}}]
+   (.setDelegateHandler element
+     (int (mask mouse-kind-bits kinds))
+     (int (mask mouse-button-bits buttons))
+     (reify Element$DelegateHandler
+       (onEvent [_ tag kind button x y]
+         (handler-fn tag (nth mouse-kinds kind) x y button))))
+   element))
+
+(defn set-event-tag!
+  "Tag an element so its mouse events go to the nearest container set up
+   with delegate-events!. Tag before adding it to its parent."
+  [^Element element tag]
+  (.setEventTag element (int tag))
+  element)
+
+;; Element recycling
+(defn release!
+  "Release a detached element. Buttons, texts and rectangles are parked
+   for reuse by the next create of the same type and shape.
+   The element must not be used afterwards."
+  [^Element element]
+  (.release element)
+  nil)
+
+(defn pool-stats
+  "Element pool statistics per type.
+
+   Example:
+     (pool-stats)
+     => {:button {:parked 3 :hits 40 :misses 5 :hit-rate 0.89} ...}"
+  []
+  (let [stats (Element/poolStats)]
+    (into {}
+          (map-indexed
+            (fn [i type]
+              (let [parked (aget stats (* 3 i))
+                    hits (aget stats (+ 1 (* 3 i)))
+                    misses (aget stats (+ 2 (* 3 i)))
+                    total (+ hits misses)]
+                [type {:parked parked
+                       :hits hits
+                       :misses misses
+                       :hit-rate (if (pos? total) (double (/ hits total)) 0.0)}])))
+          [:button :text :rectangle])))
+
+(defn layout-stats
+  "Native layout statistics since startup. Measurements are cached per
+   element by constraints; a change only invalidates the element and its
+   ancestors.
+
+   Example:
+     (layout-stats)
+     => {:measured 120 :cache-hits 940 :relayouts 35 :skipped 210 :hit-rate 0.89}"
+  []
+  (let [[measured hits relayouts skipped] (vec (Element/layoutStats))
+        total (+ measured hits)]
+    {:measured measured
+     :cache-hits hits
+     :relayouts relayouts
+     :skipped skipped
+     :hit-rate (if (pos? total) (double (/ hits total)) 0.0)}))
+
+(defn set-cache-as-bitmap!
+  "Cache a canvas's rects and polylines as a bitmap, rasterized once at
+   the window scale and shown as one image until the content or size
+   changes. Worth it for static content with many shapes, like a chart
+   background. Canvas only: its text stays live, and any other element
+   (text, rectangle, container) is left as is and false is returned."
+  [^Element element cache?]
+  (.setCacheAsBitmap element (boolean cache?)))
+
+(defn bitmap-cache-stats
+  "Bitmap cache statistics.
+
+   Example:
+     (bitmap-cache-stats)
+     => {:entries 2 :bytes 320000 :budget 33554432
+         :hits 58 :rasterized 3 :evictions 0}"
+  []
+  (let [[entries bytes budget hits rasterized evictions] (vec (Element/bitmapCacheStats))]
+    {:entries entries
+     :bytes bytes
+     :budget budget
+     :hits hits
+     :rasterized rasterized
+     :evictions evictions}))
+
+(defn set-bitmap-cache-budget!
+  "Set the memory budget of the bitmap cache in bytes. Least recently
+   shown bitmaps are evicted (their elements draw live) to stay under it."
+  [bytes]
+  (Element/setBitmapCacheBudget (long bytes)))
+
+;; In-place property updates (no rebuild, no re-parenting)
+(defn set-content!
+  "Update a text element's content in place."
+  [^Text element content]
+  (.setContent element (str content))
+  element)
+
+(defn set-font-size!
+  "Update a text element's font size in place."
+  [^Text element size]
+  (.setFontSize element (int size))
+  element)
+
+(defn set-color!
+  "Update the color of a text or rectangle element in place.
+   Color is [r g b a] or [r g b] (0-255)."
+  [element color]
+  (let [[r g b a] color
+        a (or a 255)]
+    (cond
+      (instance? Text element) (.setColor ^Text element r g b a)
+      (instance? Rectangle element) (.setColor ^Rectangle element r g b a)))
+  element)
+
 ;; Button
 (defn button
   "Create a button element.
 
    Options:
      :label        - Button text
+     :intern?      - Intern the label (for labels the UI repeats, like a
+                     \"Delete\" button per row); sent to native as an id
      :size         - [width height]
      :no-border    - Remove border (boolean)
      :no-bg        - Remove background (boolean)
      :font-size    - Font size in pixels
      :on-click     - Click handler function
      :on-right-click - Right-click handler
+     :on-middle-click - Middle-click handler
+     :on-double-click - Double-click (left button) handler
      :margin       - Margin (single int or [t r b l])
      :grow         - Whether to grow (boolean)
 
@@ -108,22 +361,28 @@
      (button {:label \"Click me!\"
               :on-click #(println \"Clicked!\")
               :size [150 40]})"
-  [{:keys [label size no-border no-bg font-size on-click on-right-click
-           margin grow]
+  [{:keys [label intern? size no-border no-bg font-size on-click on-right-click
+           on-middle-click on-double-click margin grow]
     :or {label "" font-size 12}}]
   (let [builder (Button/builder)]
-    (.label builder label)
+    (if intern?
+      (.internedLabel builder label)
+      (.label builder label))
     (.fontSize builder font-size)
     (when no-border (.noBorder builder true))
     (when no-bg (.noBg builder true))
     (when size
       (let [[w h] size]
-        (.size builder w h)))
+        (.size builder (size-spec w) (size-spec h))))
     (when on-click
       (.onClick builder (fn [btn] (on-click))))
     (when on-right-click
       (.onRightClick builder (fn [btn] (on-right-click))))
     (let [btn (.build builder)]
+      (when on-middle-click
+        (.addMouseAction btn (int (mouse-kind-bits :press)) Element/BUTTON_MIDDLE ^Runnable on-middle-click))
+      (when on-double-click
+        (.addMouseAction btn (int (mouse-kind-bits :double-click)) Element/BUTTON_LEFT ^Runnable on-double-click))
       (when margin
         (if (vector? margin)
           (apply set-margin! btn margin)
@@ -138,6 +397,8 @@
 
    Options:
      :content      - Text content
+     :intern?      - Intern the content (for labels the UI repeats); sent
+                     to native as an id
      :font-size    - Font size in pixels
      :font-family  - Font family name
      :color        - [r g b a] or [r g b] (0-255) or hex string
@@ -151,11 +412,13 @@
             :font-size 24
             :color [255 255 255]})
      (text {:content \"Faded\" :alpha 0.5})"
-  [{:keys [content font-size font-family color alpha align margin grow]
+  [{:keys [content intern? font-size font-family color alpha align margin grow]
     :or {content "" font-size 12 align "left" alpha 1.0}}]
   (let [builder (Text/builder)
         [r g b a] (or color [255 255 255 255])]
-    (.content builder content)
+    (if intern?
+      (.internedContent builder (str content))
+      (.content builder content))
     (.fontSize builder font-size)
     (when font-family
       (.fontFamily builder font-family))
@@ -171,6 +434,47 @@
         (set-grow! txt grow))
       txt)))
 
+(defn measure-text
+  "Measure text without creating an element, as [width height] in pixels.
+   Cached natively and shared with the layout of text elements, so
+   measuring the same string again is a lookup.
+
+   Options:
+     :font-size   - Font size in pixels (default 12)
+     :font-family - Font family name
+     :max-width   - Width to lay out in (default unbounded)
+
+   Example:
+     (measure-text \"Total: 42\" {:font-size 14})
+     => [58.0 17.0]"
+  ([content] (measure-text content {}))
+  ([content {:keys [font-size font-family max-width]
+             :or {font-size 12 font-family "" max-width -1}}]
+   (vec (Text/measure (str content) font-family (int font-size) (int max-width)))))
+
+(defn text-measure-stats
+  "Text measurement cache statistics.
+
+   Example:
+     (text-measure-stats)
+     => {:entries 310 :bytes 52000 :budget 2097152
+         :hits 9400 :misses 310 :evictions 0 :hit-rate 0.97}"
+  []
+  (let [[entries bytes budget hits misses evictions] (vec (Text/measureStats))
+        total (+ hits misses)]
+    {:entries entries
+     :bytes bytes
+     :budget budget
+     :hits hits
+     :misses misses
+     :evictions evictions
+     :hit-rate (if (pos? total) (double (/ hits total)) 0.0)}))
+
+(defn set-text-measure-budget!
+  "Set the memory budget of the text measurement cache in bytes."
+  [bytes]
+  (Text/setMeasureCacheBudget (long bytes)))
+
 ;; Layouts
 (defn column-layout
   "Create a vertical column layout.
@@ -190,7 +494,7 @@
         _ (.gap builder gap)
         _ (when size
             (let [[w h] size]
-              (.size builder w h)))
+              (.size builder (size-spec w) (size-spec h))))
         layout (.build builder)]
     (when margin
       (if (vector? margin)
@@ -222,7 +526,7 @@
         _ (.gap builder gap)
         _ (when size
             (let [[w h] size]
-              (.size builder w h)))
+              (.size builder (size-spec w) (size-spec h))))
         layout (.build builder)]
     (when margin
       (if (vector? margin)
@@ -236,6 +540,283 @@
       (set-align! layout align))
     layout))
 
+;; Flex
+(def ^:private flex-justify
+  {:start   Flex/JUSTIFY_START
+   :center  Flex/JUSTIFY_CENTER
+   :end     Flex/JUSTIFY_END
+   :between Flex/JUSTIFY_BETWEEN
+   :around  Flex/JUSTIFY_AROUND
+   :evenly  Flex/JUSTIFY_EVENLY})
+
+(def ^:private flex-align
+  {:auto    Flex/ALIGN_AUTO
+   :start   Flex/ALIGN_START
+   :center  Flex/ALIGN_CENTER
+   :end     Flex/ALIGN_END
+   :stretch Flex/ALIGN_STRETCH
+   ;; Direction-specific names used by the box layouts
+   :left    Flex/ALIGN_START
+   :top     Flex/ALIGN_START
+   :right   Flex/ALIGN_END
+   :bottom  Flex/ALIGN_END})
+
+(defn- rgba-vec [color]
+  (if (= 3 (count color)) (conj (vec color) 255) (vec color)))
+
+(defn flex
+  "Create a native flex container.
+
+   Children are laid out along one axis; free space goes to children by
+   their grow factor (see set-flex-item!) and the rest is distributed by
+   :justify. Background, border and rounding are drawn by the container
+   itself - no extra rectangle children.
+
+   Options:
+     :direction    - :column (default) or :row
+     :justify      - :start :center :end :between :around :evenly
+     :align        - Cross-axis :start :center :end :stretch
+     :gap          - Gap between children in pixels
+     :padding      - Inner padding in pixels
+     :size         - [width height], each a size-spec (px, :auto, :fill, "50%")
+     :background   - [r g b a] or [r g b] fill
+     :border-color - [r g b a] or [r g b] border color
+     :border       - Border thickness in pixels
+     :rounding     - Corner rounding in pixels
+     :margin       - Margin
+     :grow         - Whether to grow in a hyprtoolkit layout
+
+   Example:
+     (flex {:direction :row :justify :between :align :center
+            :padding 8 :background [40 40 48 255] :rounding 6})"
+  [{:keys [direction justify align gap padding size background border-color border rounding margin grow]
+    :or {gap 0 padding 0 border 0 rounding 0}}]
+  (let [builder (Flex/builder)]
+    (if (= direction :row) (.row builder) (.column builder))
+    (.justify builder (flex-justify justify Flex/JUSTIFY_START))
+    (.align builder (flex-align align Flex/ALIGN_START))
+    (.gap builder gap)
+    (.padding builder padding)
+    (when size
+      (let [[w h] size]
+        (.size builder (size-spec w) (size-spec h))))
+    (when background
+      (let [[r g b a] (rgba-vec background)]
+        (.background builder r g b a)))
+    (when (and border-color (pos? border))
+      (let [[r g b a] (rgba-vec border-color)]
+        (.border builder r g b a border)))
+    (.rounding builder rounding)
+    (let [container (.build builder)]
+      (when margin
+        (if (vector? margin)
+          (apply set-margin! container margin)
+          (set-margin! container margin)))
+      (when grow
+        (if (vector? grow)
+          (apply set-grow! container grow)
+          (set-grow! container grow)))
+      container)))
+
+(defn set-flex-item!
+  "Set how an element sizes inside a flex container. Applies in any
+   flex the element is (or later gets) added to.
+
+   Options:
+     :grow   - Share of free space (default 0)
+     :shrink - Share of overflow to give back (default 1)
+     :basis  - Main-axis size before growing (default: preferred size)
+     :align  - Cross-axis alignment overriding the container's
+
+   Example:
+     (set-flex-item! sidebar {:basis 200 :shrink 0})
+     (set-flex-item! content {:grow 1})"
+  [element {:keys [grow shrink basis align] :or {grow 0 shrink 1 basis -1}}]
+  (.setFlexItem element (float grow) (float shrink) (float basis)
+                (flex-align align Flex/ALIGN_AUTO)))
+
+;; Grid
+(defn- track-spec
+  "Encode a grid track: px number, [:fr n] or \"1fr\", :auto."
+  [track]
+  (cond
+    (number? track) (if (neg? track) Grid/AUTO (Grid/px (int track)))
+    (= track :auto) Grid/AUTO
+    (and (string? track) (.endsWith ^String track "fr"))
+    (Grid/fr (Double/parseDouble (subs track 0 (- (count track) 2))))
+    (and (vector? track) (= :fr (first track))) (Grid/fr (double (second track)))
+    :else (throw (ex-info "Invalid grid track" {:track track}))))
+
+(defn- track-array [tracks]
+  (int-array (map track-spec tracks)))
+
+(defn grid
+  "Create a native grid container.
+
+   Children go into cells of row and column tracks; a track is a pixel
+   size, a fraction of the leftover space (\"1fr\" or [:fr 1]) or :auto
+   (sized by content). Children without a cell (see set-grid-cell!) fill
+   the next free cell row by row; rows beyond :rows are added as :auto.
+
+   Options:
+     :columns      - Column tracks, e.g. [120 \"1fr\" :auto]
+     :rows         - Row tracks (default: all :auto)
+     :gap          - Gap between tracks, or [row-gap column-gap]
+     :align        - Alignment in cells: :start :center :end :stretch (default)
+     :padding      - Inner padding in pixels
+     :size         - [width height], each a size-spec
+     :background   - [r g b a] or [r g b] fill
+     :border-color - [r g b a] or [r g b] border color
+     :border       - Border thickness in pixels
+     :rounding     - Corner rounding in pixels
+     :margin       - Margin
+     :grow         - Whether to grow in a hyprtoolkit layout
+
+   Example:
+     (grid {:columns [\"1fr\" \"2fr\" 80] :gap [4 12] :padding 8})"
+  [{:keys [columns rows gap align padding size background border-color border rounding margin grow]
+    :or {columns [:auto] rows [] gap 0 padding 0 border 0 rounding 0}}]
+  (let [builder (Grid/builder)
+        [row-gap column-gap] (if (vector? gap) gap [gap gap])]
+    (.columns builder (track-array columns))
+    (.rows builder (track-array rows))
+    (.gap builder row-gap column-gap)
+    (.align builder (flex-align align Flex/ALIGN_STRETCH))
+    (.padding builder padding)
+    (when size
+      (let [[w h] size]
+        (.size builder (size-spec w) (size-spec h))))
+    (when background
+      (let [[r g b a] (rgba-vec background)]
+        (.background builder r g b a)))
+    (when (and border-color (pos? border))
+      (let [[r g b a] (rgba-vec border-color)]
+        (.border builder r g b a border)))
+    (.rounding builder rounding)
+    (let [container (.build builder)]
+      (when margin
+        (if (vector? margin)
+          (apply set-margin! container margin)
+          (set-margin! container margin)))
+      (when grow
+        (if (vector? grow)
+          (apply set-grow! container grow)
+          (set-grow! container grow)))
+      container)))
+
+(defn set-grid-tracks!
+  "Replace a grid's column and row tracks; relayouts natively."
+  [grid {:keys [columns rows] :or {columns [:auto] rows []}}]
+  (.setTracks grid (track-array columns) (track-array rows))
+  grid)
+
+(defn set-grid-cell!
+  "Place an element in a grid cell. Applies in any grid the element is
+   (or later gets) added to. Omitted :row / :column are placed
+   automatically.
+
+   Options:
+     :row      - Row index (0-based)
+     :column   - Column index (0-based)
+     :row-span - Rows covered (default 1)
+     :col-span - Columns covered (default 1)
+
+   Example:
+     (set-grid-cell! header {:row 0 :column 0 :col-span 3})"
+  [element {:keys [row column row-span col-span] :or {row -1 column -1 row-span 1 col-span 1}}]
+  (.setGridCell element (int row) (int column) (int row-span) (int col-span))
+  element)
+
+;; Canvas
+(defn- pack-color [color]
+  (let [[r g b a] (rgba-vec color)]
+    (DisplayList/rgba r g b a)))
+
+(defn display-list
+  "Encode drawing commands into a DisplayList (one native buffer).
+   Reuses `dl` when given. nil commands are skipped.
+
+   Commands:
+     [:rect x y w h color]
+     [:rect x y w h color {:rounding 4 :border 1 :border-color [r g b a]}]
+     [:polyline [[x y] ...] color thickness]
+     [:text x y \"label\" {:size 12 :color [r g b a]}]
+     [:clip x y w h]              ; until the matching :restore
+     [:save] [:restore]
+     [:translate dx dy] [:scale sx sy]"
+  ([commands]
+   (display-list (DisplayList.) commands))
+  ([^DisplayList dl commands]
+   (.clear dl)
+   (doseq [[op & args] commands :when op]
+     (case op
+       :rect (let [[x y w h color {:keys [rounding border border-color]
+                                   :or {rounding 0 border 0 border-color [0 0 0 0]}}] args]
+               (.rect dl (float x) (float y) (float w) (float h) (int (pack-color color))
+                      (float rounding) (int (pack-color border-color)) (float border)))
+       :polyline (let [[points color thickness] args]
+                   (.polyline dl (float-array (mapcat identity points)) (int (pack-color color))
+                              (float (or thickness 1))))
+       :text (let [[x y content {:keys [size color] :or {size 12 color [255 255 255 255]}}] args]
+               (.text dl (float x) (float y) (str content) (float size) (int (pack-color color))))
+       :clip (let [[x y w h] args]
+               (.clip dl (float x) (float y) (float w) (float h)))
+       :save (.save dl)
+       :restore (.restore dl)
+       :translate (let [[dx dy] args] (.translate dl (float dx) (float dy)))
+       :scale (let [[sx sy] args] (.scale dl (float sx) (float sy)))))
+   dl))
+
+(defn canvas
+  "Create a native canvas drawing a list of commands (see display-list)
+   as a single element.
+
+   Options:
+     :size     - [width height] size-specs (default: extent of the content)
+     :commands - Drawing commands
+     :cache-as-bitmap - Rasterize rects and lines once into a bitmap
+                        (canvas only, see set-cache-as-bitmap!)
+     :margin   - Margin
+     :grow     - Whether to grow in a hyprtoolkit layout
+
+   Example:
+     (canvas {:size [200 100]
+              :commands [[:rect 0 0 200 100 [30 30 40 255] {:rounding 6}]
+                         [:polyline [[0 80] [100 20] [200 60]] [100 150 255 255] 2]]})"
+  [{:keys [size commands cache-as-bitmap margin grow]}]
+  (let [builder (Canvas/builder)]
+    (when size
+      (let [[w h] size]
+        (.size builder (size-spec w) (size-spec h))))
+    (let [element (.build builder)]
+      (when cache-as-bitmap
+        (.setCacheAsBitmap element true))
+      (when (seq commands)
+        (.setCommands element (display-list commands)))
+      (when margin
+        (if (vector? margin)
+          (apply set-margin! element margin)
+          (set-margin! element margin)))
+      (when grow
+        (if (vector? grow)
+          (apply set-grow! element grow)
+          (set-grow! element grow)))
+      element)))
+
+(defn set-canvas-commands!
+  "Replace a canvas' commands. Only commands that differ from the
+   previous list are redrawn natively."
+  [^Canvas canvas commands]
+  (.setCommands canvas (display-list commands))
+  canvas)
+
+(defn replace-canvas-commands!
+  "Replace commands [from, to) of a canvas; to = -1 replaces through
+   the end. Useful to update one series of a chart."
+  [^Canvas canvas from to commands]
+  (.replaceCommands canvas (int from) (int to) (display-list commands))
+  canvas)
+
 ;; Textbox
 (defn textbox
   "Create a text input field.
@@ -245,7 +826,8 @@
      :initial-text - Initial text content
      :size         - [width height]
      :on-submit    - Handler called when Enter is pressed (receives text)
-     :on-change    - Handler called when text changes (receives text)
+     :on-change    - Handler called when text changes (receives the whole
+                     text, at most once per frame)
      :margin       - Margin
      :grow         - Whether to grow
 
@@ -260,7 +842,7 @@
     (.initialText builder initial-text)
     (when size
       (let [[w h] size]
-        (.size builder w h)))
+        (.size builder (size-spec w) (size-spec h))))
     (when on-submit
       (.onSubmit builder on-submit))
     (when on-change
@@ -295,7 +877,10 @@
     (.label builder label)
     (.checked builder checked)
     (when on-change
-      (.onChange builder on-change))
+      (.onToggle builder
+        (reify Checkbox$ToggleHandler
+          (onToggle [_ checked]
+            (on-change checked)))))
     (let [cb (.build builder)]
       (when margin
         (if (vector? margin)
@@ -345,7 +930,7 @@
     (.alpha builder (float alpha))
     (when size
       (let [[w h] size]
-        (.size builder w h)))
+        (.size builder (size-spec w) (size-spec h))))
     (let [rect (.build builder)]
       (when margin
         (if (vector? margin)
@@ -355,6 +940,89 @@
         (set-grow! rect grow))
       rect)))
 
+;; Bulk construction
+(defn- column
+  "A direct int column of (f item) for each item, or nil when no item
+   sets k (the native default is used)."
+  [items k f]
+  (when (some #(contains? % k) items)
+    (Columns/of (int-array (map f items)))))
+
+(defn- position-columns
+  "[xs ys] columns from each item's :position [x y], or nil."
+  [items]
+  (when (some :position items)
+    [(Columns/of (int-array (map #(first (:position % [0 0])) items)))
+     (Columns/of (int-array (map #(second (:position % [0 0])) items)))]))
+
+(defn rectangles
+  "Create many rectangles in one native call, e.g. the cells of a large
+   table or heatmap. Each item takes :color, :border-color, :border,
+   :rounding, :size and :position [x y] (absolute, in the parent); the
+   fields are sent as column buffers rather than one call per element.
+
+   Options:
+     :parent - Add the rectangles to this element, with a single relayout
+
+   Example:
+     (rectangles (for [row (range 100) col (range 20)]
+                   {:color [40 40 (* 2 row) 255]
+                    :size [30 12]
+                    :position [(* col 32) (* row 14)]})
+                 {:parent grid-area})"
+  ([items] (rectangles items {}))
+  ([items {:keys [parent]}]
+   (let [items (vec items)
+         batch (Rectangle/batch (count items))
+         [xs ys] (position-columns items)]
+     (some->> (column items :color #(pack-color (:color % [255 255 255 255]))) (.colors batch))
+     (some->> (column items :border-color #(pack-color (:border-color % [0 0 0 255]))) (.borderColors batch))
+     (some->> (column items :border #(:border % 0)) (.borderThicknesses batch))
+     (some->> (column items :rounding #(:rounding % 0)) (.roundings batch))
+     (when (some :size items)
+       (.sizes batch
+               (Columns/of (int-array (map #(size-spec (first (:size %))) items)))
+               (Columns/of (int-array (map #(size-spec (second (:size %))) items)))))
+     (when xs
+       (.positions batch xs ys))
+     (when parent
+       (.parent batch parent))
+     (vec (.build batch)))))
+
+(defn texts
+  "Create many text elements in one native call. Each item takes
+   :content, :font-size, :color and :position [x y] (absolute, in the
+   parent); all share one font family.
+
+   Options:
+     :parent      - Add the elements to this element, with a single relayout
+     :font-family - Font family name
+     :intern?     - Intern the contents (for values the UI repeats, like
+                    column headers or enum labels); sent to native as ids
+
+   Example:
+     (texts (for [[i label] (map-indexed vector labels)]
+              {:content label :font-size 11 :position [4 (* i 14)]})
+            {:parent table :intern? true})"
+  ([items] (texts items {}))
+  ([items {:keys [parent font-family intern?]}]
+   (let [items (vec items)
+         contents (into-array String (map #(str (:content % "")) items))
+         batch (Text/batch (count items))
+         [xs ys] (position-columns items)]
+     (if intern?
+       (.internedContents batch contents)
+       (.contents batch contents))
+     (when font-family
+       (.fontFamily batch font-family))
+     (some->> (column items :font-size #(:font-size % 12)) (.fontSizes batch))
+     (some->> (column items :color #(pack-color (:color % [255 255 255 255]))) (.colors batch))
+     (when xs
+       (.positions batch xs ys))
+     (when parent
+       (.parent batch parent))
+     (vec (.build batch)))))
+
 (defn scroll-area
   "Create a scrollable area (container).
 
@@ -377,7 +1045,7 @@
       (.blockUserScroll builder true))
     (when size
       (let [[w h] size]
-        (.size builder w h)))
+        (.size builder (size-spec w) (size-spec h))))
     (let [scroll (.build builder)]
       (when margin
         (if (vector? margin)
@@ -420,7 +1088,7 @@
     (.points builder points-array)
     (when size
       (let [[w h] size]
-        (.size builder w h)))
+        (.size builder (size-spec w) (size-spec h))))
     (let [ln (.build builder)]
       (when margin
         (if (vector? margin)
@@ -1,6 +1,8 @@
 (ns hyprclj.input
   "Keyboard input and focus management."
-  (:import [org.hyprclj.bindings Window$KeyboardListener]))
+  (:require [clojure.string :as str])
+  (:import [org.hyprclj.bindings Element Element$KeyHandler Element$TextKeyHandler
+            Textbox Window Window$KeyboardListener Window$KeyListener]))
 
 ;; Global focus tracking
 (defonce ^:private focused-element (atom nil))
@@ -23,51 +25,29 @@
 ;; Track shift state (public so text-input can access)
 (defonce shift-pressed (atom false))
 
+(def ^:private keycode-chars
+  "Keycode -> [unshifted shifted] characters, indexed by keycode."
+  (let [pairs (merge
+                (zipmap (range 16 26) (map (fn [c] [c (Character/toUpperCase (char c))]) "qwertyuiop"))
+                (zipmap (range 30 39) (map (fn [c] [c (Character/toUpperCase (char c))]) "asdfghjkl"))
+                (zipmap (range 44 51) (map (fn [c] [c (Character/toUpperCase (char c))]) "zxcvbnm"))
+                (zipmap (range 2 12) (map vector "1234567890" "!@#$%^&*()"))
+                {57 [\space \space]
+                 12 [\- \_]
+                 13 [\= \+]
+                 51 [\, \<]
+                 52 [\. \>]
+                 53 [\/ \?]})]
+    (mapv pairs (range 64))))
+
 (defn keycode->char
   "Convert Linux keycode to character.
    Returns nil for non-printable keys."
   [keycode shift?]
   (let [code (int keycode)]
-    (cond
-      ;; Letters
-      (and (>= code 30) (<= code 38))  ; A-I
-      (let [ch (char (+ (- code 30) (int \a)))]
-        (if shift? (Character/toUpperCase ch) ch))
-
-      (and (>= code 16) (<= code 25))  ; Q-P
-      (let [offset (- code 16)
-            chars "qwertyuiop"
-            ch (nth chars offset)]
-        (if shift? (Character/toUpperCase ch) ch))
-
-      (and (>= code 44) (<= code 50))  ; Z-M
-      (let [offset (- code 44)
-            chars "zxcvbnm"
-            ch (nth chars offset)]
-        (if shift? (Character/toUpperCase ch) ch))
-
-      ;; Numbers
-      (= code 2) (if shift? \! \1)
-      (= code 3) (if shift? \@ \2)
-      (= code 4) (if shift? \# \3)
-      (= code 5) (if shift? \$ \4)
-      (= code 6) (if shift? \% \5)
-      (= code 7) (if shift? \^ \6)
-      (= code 8) (if shift? \& \7)
-      (= code 9) (if shift? \* \8)
-      (= code 10) (if shift? \( \9)
-      (= code 11) (if shift? \) \0)
-
-      ;; Special chars
-      (= code 57) \space
-      (= code 12) (if shift? \_ \-)
-      (= code 13) (if shift? \+ \=)
-      (= code 51) (if shift? \< \,)
-      (= code 52) (if shift? \> \.)
-      (= code 53) (if shift? \? \/)
-
-      ;; Default
-      :else nil)))
+    (when (< -1 code (count keycode-chars))
+      (when-let [[plain shifted] (nth keycode-chars code)]
+        (if shift? shifted plain)))))
 
 (defn setup-keyboard-handler!
   "Set up keyboard event handling for a window.
@@ -120,14 +100,161 @@
   [element]
   (= @focused-element element))
 
+;; ===== Native focus chain =====
+;;
+;; Focus and key dispatch run natively per window: Tab / Shift+Tab walk the
+;; focus chain, a focused Textbox edits its text without leaving native
+;; code, and other elements get one direct call into their key handler.
+
+(defn add-focusable!
+  "Add an element to a window's focus chain (Tab order = insertion order).
+
+   handler-fn is optional: (fn [keysym pressed? modifiers]) returning
+   truthy to consume the key, or with {:text? true}
+   (fn [keysym pressed? utf8 modifiers]) when it needs the typed text.
+   Textboxes need no handler.
+
+   Example:
+     (add-focusable! window my-button
+       (fn [keysym pressed? _]
+         (when (and pressed? (= keysym 0xff0d)) (activate!) true)))"
+  ([^Window window ^Element element]
+   (.addFocusable window element)
+   element)
+  ([window element handler-fn]
+   (add-focusable! window element handler-fn {}))
+  ([^Window window ^Element element handler-fn {:keys [text?]}]
+   (if text?
+     (.setKeyHandler element
+       (reify Element$TextKeyHandler
+         (onKey [_ keysym pressed utf8 modifiers]
+           (boolean (handler-fn keysym pressed utf8 modifiers)))))
+     (.setKeyHandler element
+       (reify Element$KeyHandler
+         (onKey [_ keysym pressed modifiers]
+           (boolean (handler-fn keysym pressed modifiers))))))
+   (add-focusable! window element)))
+
+(defn remove-focusable!
+  "Remove an element from a window's focus chain."
+  [^Window window ^Element element]
+  (.removeFocusable window element))
+
+(defn focus-element!
+  "Give native keyboard focus to an element (nil clears focus)."
+  [^Window window element]
+  (.focus window element))
+
+(defn focus-next!
+  "Move focus forward along the chain, like Tab."
+  [^Window window]
+  (.focusNext window))
+
+(defn focus-prev!
+  "Move focus backward along the chain, like Shift+Tab."
+  [^Window window]
+  (.focusPrev window))
+
+(defn focused?
+  "Check if an element has native keyboard focus in a window."
+  [^Window window ^Element element]
+  (.isFocused window element))
+
+;; ===== Key bindings =====
+
+(def ^:private modifier-bits
+  {"shift" 1 "ctrl" 4 "control" 4 "alt" 8 "super" 64 "meta" 64})
+
+(def ^:private named-keysyms
+  {"enter" 0xff0d "return" 0xff0d "esc" 0xff1b "escape" 0xff1b
+   "tab" 0xff09 "backspace" 0xff08 "delete" 0xffff "space" 0x20
+   "left" 0xff51 "up" 0xff52 "right" 0xff53 "down" 0xff54
+   "home" 0xff50 "end" 0xff57 "pageup" 0xff55 "pagedown" 0xff56})
+
+(defn- parse-step
+  "Parse \"ctrl+shift+k\" into [keysym modifiers]."
+  [step]
+  (let [parts (str/split (str/lower-case step) #"\+")
+        key-name (last parts)
+        mods (reduce + 0 (map #(or (modifier-bits %)
+                                   (throw (IllegalArgumentException. (str "Unknown modifier: " %))))
+                              (butlast parts)))
+        keysym (or (named-keysyms key-name)
+                   (when-let [[_ n] (re-matches #"f(\d+)" key-name)]
+                     (+ 0xffbd (Long/parseLong n)))  ; F1 = 0xffbe
+                   (when (= 1 (count key-name))
+                     (int (first key-name)))
+                   (throw (IllegalArgumentException. (str "Unknown key: " key-name))))]
+    [keysym mods]))
+
+(defn bind-keys!
+  "Bind a shortcut or chord on a window. Matching is native; action runs
+   only when the whole sequence is typed. Returns a binding id.
+
+   Steps are separated by spaces, keys within a step by +.
+
+   Options:
+     :on - :press (default) or :release of the final key
+
+   Examples:
+     (bind-keys! window \"ctrl+s\" save!)
+     (bind-keys! window \"ctrl+x ctrl+c\" #(hypr/exit!))
+     (bind-keys! window \"f5\" refresh! {:on :release})"
+  ([window spec action]
+   (bind-keys! window spec action {}))
+  ([^Window window spec action {:keys [on] :or {on :press}}]
+   (let [steps (map parse-step (str/split (str/trim spec) #"\s+"))]
+     (.bindKeys window
+                (int-array (map first steps))
+                (int-array (map second steps))
+                (= on :release)
+                ^Runnable action))))
+
+(defn set-key-listener!
+  "Set an allocation-free keyboard listener on a window, called with
+   (keysym pressed? modifiers) for events not handled natively.
+   Call key-text inside it when the typed text is needed.
+
+   Example:
+     (set-key-listener! window
+       (fn [keysym pressed? mods]
+         (when pressed? (println \"Typed:\" (key-text)))))"
+  [^Window window handler-fn]
+  (.setKeyListener window
+    (reify Window$KeyListener
+      (onKey [_ keysym pressed modifiers]
+        (handler-fn keysym pressed modifiers)))))
+
+(defn key-text
+  "Text typed by the key event being dispatched, or nil.
+   Only valid inside a key listener or key handler."
+  []
+  (Window/keyText))
+
+(defn unbind-keys!
+  "Remove a binding returned by bind-keys!."
+  [^Window window id]
+  (.unbindKeys window (int id)))
+
+(defn set-catch-all!
+  "Forward keys not handled natively to the window's keyboard listener."
+  [^Window window enabled?]
+  (.setCatchAll window (boolean enabled?)))
+
 (defn route-keyboard-to-focused!
   "Set up keyboard routing to focused element.
-   Call this once per window after creation."
+   Call this once per window after creation.
+
+   A focused Textbox gets the full event applied to its native text model;
+   other focused elements get (handler keycode pressed?)."
   [window]
   (setup-keyboard-handler! window
-    (fn [keycode pressed]
-      (when-let [handler @focused-handler]
-        (handler keycode pressed)))))
+    (fn [keycode pressed utf8 modifiers]
+      (let [element @focused-element]
+        (if (instance? Textbox element)
+          (.handleKey ^Textbox element keycode pressed utf8 modifiers)
+          (when-let [handler @focused-handler]
+            (handler keycode pressed)))))))
 
 (comment
   ;; Example usage:
@@ -133,6 +133,7 @@
   [parent-elem atoms-vec component-fn]
 
   (let [watch-id (gensym "keyed-watch-")
+        remount-key (hypr/idle-key)
         current-vnodes (atom [])]
 
     ;; Function to remount with keyed reconciliation
@@ -153,7 +154,9 @@
                                                       (vec children))]
 
                     ;; Store new vnodes
-                    (reset! current-vnodes new-vnodes)))))]
+                    (reset! current-vnodes new-vnodes)))
+                ;; Several watched atoms changing at once remount once
+                {:key remount-key}))]
 
       ;; Initial mount
       (remount!)
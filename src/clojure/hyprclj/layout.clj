@@ -11,11 +11,11 @@
      :gap         - Space between children (px)
      :margin      - Outer margin (px or [v h] or [t r b l])
      :padding     - Same as margin
-     :size        - [width height] or :auto
-     :width       - Width (overrides :size)
+     :size        - [width height] or :auto; axes take el/size-spec values
+     :width       - Width (overrides :size), e.g. 200, :fill or \"50%\"
      :height      - Height (overrides :size)
-     :min-width   - Minimum width
-     :min-height  - Minimum height
+     :min-width   - Minimum width (px)
+     :min-height  - Minimum height (px)
      :align       - Cross-axis alignment: :start :center :end
      :justify     - Main-axis distribution: :start :center :end :between :around
      :children    - Child elements (or pass as varargs)
@@ -37,12 +37,15 @@
         final-size (when (or w h) [(or w -1) (or h -1)])
         m (or padding margin)]
 
-    (el/column-layout
-      (cond-> {:gap gap}
-        final-size (assoc :size final-size)
-        m (assoc :margin m)
-        grow (assoc :grow grow)
-        align (assoc :align align)))))
+    (cond-> (el/flex
+              (cond-> {:direction :column :gap gap}
+                final-size (assoc :size final-size)
+                m (assoc :margin m)
+                grow (assoc :grow grow)
+                align (assoc :align align)
+                justify (assoc :justify justify)))
+      (or min-width min-height)
+      (el/set-size-constraints! {:min [(or min-width -1) (or min-height -1)]}))))
 
 (defn h-box
   "Horizontal box layout (row).
@@ -52,7 +55,8 @@
    Example:
      (h-box {:gap 10 :align :center}
        button1 button2 button3)"
-  [{:keys [gap margin padding size width height align justify children grow]
+  [{:keys [gap margin padding size width height min-width min-height
+           align justify children grow]
     :or {gap 0}
     :as opts}
    & child-elements]
@@ -63,12 +67,15 @@
         final-size (when (or w h) [(or w -1) (or h -1)])
         m (or padding margin)]
 
-    (el/row-layout
-      (cond-> {:gap gap}
-        final-size (assoc :size final-size)
-        m (assoc :margin m)
-        grow (assoc :grow grow)
-        align (assoc :align align)))))
+    (cond-> (el/flex
+              (cond-> {:direction :row :gap gap}
+                final-size (assoc :size final-size)
+                m (assoc :margin m)
+                grow (assoc :grow grow)
+                align (assoc :align align)
+                justify (assoc :justify justify)))
+      (or min-width min-height)
+      (el/set-size-constraints! {:min [(or min-width -1) (or min-height -1)]}))))
 
 (defn box
   "Generic container box.
@@ -101,7 +108,8 @@
   ([] (spacer {}))
   ([{:keys [size] :or {size 1}}]
    (doto (el/column-layout {:size [size size]})
-     (el/set-grow! true true))))  ; Grow both directions
+     (el/set-grow! true true)  ; Grow both directions
+     (el/set-flex-item! {:grow 1}))))  ; ...and inside flex boxes
 
 (defn line
   "Horizontal or vertical line (separator).
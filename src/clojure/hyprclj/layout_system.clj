@@ -22,7 +22,17 @@
 
     element))
 
-;; v-box: Creates column layout, returns it for children to be added via compile-children
+;; Props shared by v-box and h-box, mapped onto the native flex container
+(defn- flex-box [direction props]
+  (let [container (elem/flex (-> props
+                                 (select-keys [:gap :size :margin :grow :justify :align
+                                               :padding :background :border :border-color
+                                               :rounding])
+                                 (assoc :direction direction)))]
+    ;; Positioning applies to the box itself; :align is for its children
+    (apply-element-props! container (dissoc props :align))
+    container))
+
 (defn v-box
   "Vertical layout box (column).
 
@@ -33,30 +43,20 @@
 
    Props:
      :gap - Spacing between children
-     :align - Child alignment: :left (default), :center, :right
+     :justify - Vertical distribution: :start (default), :center, :end,
+                :between, :around, :evenly
+     :align - Child alignment: :left (default), :center, :right, :stretch
      :position - :absolute to pin to top-left
-     :padding - Internal padding (adds margin to all children)
+     :padding - Internal padding
      :background - Background color [r g b a]
      :border - Border thickness with :border-color
+     :rounding - Corner rounding of background and border
      :size, :margin, :grow - Standard element props
 
-   Note: :background/:border create a rectangle as the first child"
+   Backed by a native flex container, which draws the background and
+   border itself."
   [props]
-  (let [column (elem/column-layout (select-keys props [:gap :size :margin :grow]))]
-    ;; Apply positioning and alignment to the column itself
-    (apply-element-props! column props)
-
-    ;; Add background/border rectangle as first child if specified
-    (when (or (:background props) (:border props))
-      (let [bg-rect (elem/rectangle
-                      {:color (or (:background props) [0 0 0 0])
-                       :border-color (:border-color props)
-                       :border (or (:border props) 0)
-                       :rounding (or (:rounding props) 0)
-                       :size (:size props)})]  ; NO :grow - let content have space!
-        (elem/add-child! column bg-rect)))
-
-    column))
+  (flex-box :column props))
 
 (defn h-box
   "Horizontal layout box (row).
@@ -68,30 +68,20 @@
 
    Props:
      :gap - Spacing between children
-     :align - Child alignment: :top (default), :center, :bottom
+     :justify - Horizontal distribution: :start (default), :center, :end,
+                :between, :around, :evenly
+     :align - Child alignment: :top (default), :center, :bottom, :stretch
      :position - :absolute to pin to top-left
-     :padding - Internal padding (adds margin to all children)
+     :padding - Internal padding
      :background - Background color [r g b a]
      :border - Border thickness with :border-color
+     :rounding - Corner rounding of background and border
      :size, :margin, :grow - Standard element props
 
-   Note: :background/:border create a rectangle as the first child"
+   Backed by a native flex container, which draws the background and
+   border itself."
   [props]
-  (let [row (elem/row-layout (select-keys props [:gap :size :margin :grow]))]
-    ;; Apply positioning and alignment to the row itself
-    (apply-element-props! row props)
-
-    ;; Add background/border rectangle as first child if specified
-    (when (or (:background props) (:border props))
-      (let [bg-rect (elem/rectangle
-                      {:color (or (:background props) [0 0 0 0])
-                       :border-color (:border-color props)
-                       :border (or (:border props) 0)
-                       :rounding (or (:rounding props) 0)
-                       :size (:size props)})]  ; NO :grow
-        (elem/add-child! row bg-rect)))
-
-    row))
+  (flex-box :row props))
 
 (defn box
   "Generic box - chooses v-box or h-box based on :direction.
@@ -104,7 +94,7 @@
     (h-box props)
     (v-box props)))
 
-;; colored-button: Button with colored background via layering trick
+;; colored-button: Button over a flex container's own background
 (defn colored-button
   "Create a button with a colored background.
 
@@ -121,28 +111,18 @@
                       :on-click #(println \"Hi\")})"
   [{:keys [bg-color border-color border rounding] :as props}]
   (if bg-color
-    ;; Create container with background rectangle + button
-    (let [container (elem/column-layout {:size (:size props)})
-          [w h] (:size props)]
-      ;; Layer 1: Background rectangle (absolute 0,0)
-      (when bg-color
-        (let [bg (elem/rectangle {:color bg-color
-                                  :border-color border-color
-                                  :border (or border 0)
-                                  :rounding (or rounding 5)
-                                  :size [w h]})]
-          (elem/set-position-mode! bg 0)
-          (elem/set-absolute-position! bg 0 0)
-          (elem/add-child! container bg)))
-
-      ;; Layer 2: Button on top (absolute 0,0, no-bg)
-      (let [btn (elem/button (assoc props
-                                    :no-bg true   ; Transparent background
-                                    :no-border true))]  ; No border, use rectangle's
-        (elem/set-position-mode! btn 0)
-        (elem/set-absolute-position! btn 0 0)
-        (elem/add-child! container btn))
-
+    ;; The container paints the background; the button stretches over it
+    (let [container (elem/flex {:size (:size props)
+                                :align :stretch
+                                :background bg-color
+                                :border-color border-color
+                                :border (or border 0)
+                                :rounding (or rounding 5)})
+          btn (elem/button (assoc props
+                                  :no-bg true   ; Transparent background
+                                  :no-border true))]  ; No border, use the container's
+      (elem/set-flex-item! btn {:grow 1})
+      (elem/add-child! container btn)
       container)
     ;; No color - just regular button
     (elem/button props)))
@@ -0,0 +1,86 @@
+(ns hyprclj.palette
+  "Shared color slots.
+
+   A slot holds one color natively. Elements given (color slot) read it at
+   paint time, so set-color! and animate! repaint every bound element without a
+   re-render or rebuild. Themes keep a handful of slots and switch them
+   with set-theme!.
+
+   Slot colors work as :color of text, rectangle and line elements (and
+   :border-color of rectangles); they are not real colors, so don't feed
+   them to color-fx."
+  (:require [hyprclj.color :as color]
+            [hyprclj.core :as core])
+  (:import [org.hyprclj.bindings Palette]))
+
+(defn create!
+  "Create a slot holding a color ([r g b a], [r g b] or hex string).
+   Returns the slot id. Slots live as long as the process."
+  [c]
+  (let [[r g b a] (color/normalize-color c)]
+    (Palette/create r g b a)))
+
+(defn color
+  "The color value referring to a slot, for element :color props.
+
+   Example:
+     (def accent (create! [80 140 255 255]))
+     (text {:content \"Hi\" :color (color accent)})"
+  [slot]
+  [(Palette/ref slot) 0 0 0])
+
+(defn set-color!
+  "Set a slot's color (stopping any animation) and repaint its elements."
+  [slot c]
+  (let [[r g b a] (color/normalize-color c)]
+    (Palette/set slot r g b a))
+  slot)
+
+(defn current
+  "A slot's current color as [r g b a], mid-animation values included."
+  [slot]
+  (let [v (Palette/get slot)]
+    [(bit-and (unsigned-bit-shift-right v 24) 0xFF)
+     (bit-and (unsigned-bit-shift-right v 16) 0xFF)
+     (bit-and (unsigned-bit-shift-right v 8) 0xFF)
+     (bit-and v 0xFF)]))
+
+(defn animate!
+  "Animate a slot to a color, linearly over duration-ms. Runs natively;
+   no Clojure code runs per frame.
+
+   Example:
+     (animate! accent [255 80 80 255] 300)"
+  [slot c duration-ms]
+  (let [[r g b a] (color/normalize-color c)]
+    (Palette/animate (core/get-backend) slot r g b a (int duration-ms)))
+  slot)
+
+(defn set-theme!
+  "Set several slots at once from a map of slot-key -> color, using a
+   map of slot-key -> slot id. With duration-ms, animate instead.
+
+   Example:
+     (def slots {:bg (create! \"#1e1e2e\") :fg (create! \"#cdd6f4\")})
+     (set-theme! slots {:bg \"#eff1f5\" :fg \"#4c4f69\"} 200)"
+  ([slots theme] (set-theme! slots theme nil))
+  ([slots theme duration-ms]
+   (doseq [[k c] theme
+           :let [slot (get slots k)]
+           :when slot]
+     (if duration-ms
+       (animate! slot c duration-ms)
+       (set-color! slot c)))
+   slots))
+
+(defn stats
+  "Palette statistics.
+
+   Example:
+     (stats)
+     => {:slots 6 :bindings 420 :repaints 1260}"
+  []
+  (let [[slots bindings repaints] (vec (Palette/stats))]
+    {:slots slots
+     :bindings bindings
+     :repaints repaints}))
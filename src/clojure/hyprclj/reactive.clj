@@ -1,7 +1,8 @@
 (ns hyprclj.reactive
   "Reactive state management layer for Hyprclj.
    Provides Reagent-style reactivity with atoms and automatic UI updates."
-  (:require [hyprclj.elements :as el]))
+  (:require [hyprclj.elements :as el]
+            [hyprclj.signal :as signal]))
 
 ;; Track which components are watching which atoms
 (defonce ^:private watchers (atom {}))
@@ -20,9 +21,11 @@
   (swap! watchers update atm (fnil conj #{}) component-id))
 
 (defn reactive-atom?
-  "Check if a value is a reactive atom."
+  "Check if a value is a derefable state child (an atom or a signal).
+   Only signals are tracked as dependencies (see track-derefs)."
   [x]
-  (instance? clojure.lang.Atom x))
+  (or (instance? clojure.lang.Atom x)
+      (signal/signal? x)))
 
 (defn cursor
   "Create a cursor into a nested atom structure.
@@ -52,23 +55,21 @@
        (apply swap! atm update-in path f x y args)))))
 
 (defn track-derefs
-  "Execute f and track all atom derefs within it.
-   Returns [result derefed-atoms]."
+  "Execute f and track the ratoms/reactions it derefs.
+   Returns [result derefed-atoms].
+
+   Tracking goes through a per-thread binding (see hyprclj.signal), so
+   only ratoms and reactions are seen - plain atoms are not tracked."
   [f]
-  (let [derefed (atom #{})]
-    (with-redefs [deref (fn [x]
-                          (when (reactive-atom? x)
-                            (swap! derefed conj x))
-                          (clojure.core/deref x))]
-      (let [result (f)]
-        [result @derefed]))))
+  (signal/track f))
 
 (defn make-reactive
   "Wrap a component function to make it reactive.
-   When any atom it derefs changes, the component will re-render.
+   When any ratom or reaction (signal) it derefs changes, the component
+   will re-render. Plain atoms are read but not tracked.
 
    Example:
-     (def counter (atom 0))
+     (def counter (ratom 0))
      (defn my-component []
        (make-reactive
          (fn []
@@ -109,12 +110,14 @@
 ;; Ratom - Reactive atom (like Reagent's ratom)
 (defn ratom
   "Create a reactive atom. Like a regular atom, but triggers UI updates.
+   Backed by a signal: deref, swap!, reset!, swap-vals!, reset-vals! and
+   add-watch work as usual.
 
    Example:
      (def count (ratom 0))
      (swap! count inc) ;; UI will update automatically"
   [initial-value]
-  (atom initial-value))
+  (signal/signal initial-value))
 
 ;; Higher-order component for reactions
 (defn reaction
@@ -128,23 +131,7 @@
      (swap! count inc)
      @doubled ;; => 2"
   [f]
-  (let [value (atom nil)
-        deps (atom #{})]
-
-    ;; Initial computation
-    (let [[result new-deps] (track-derefs f)]
-      (reset! value result)
-      (reset! deps new-deps)
-
-      ;; Watch dependencies
-      (doseq [dep new-deps]
-        (add-watch dep (gensym "reaction-")
-                   (fn [_ _ old-val new-val]
-                     (when (not= old-val new-val)
-                       (let [[new-result _] (track-derefs f)]
-                         (reset! value new-result)))))))
-
-    value))
+  (signal/computed f))
 
 (comment
   ;; Example usage:
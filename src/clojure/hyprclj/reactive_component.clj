@@ -2,34 +2,30 @@
   "Component-level reactivity without full VDOM reconciliation.
    Components automatically remount when their dependencies change."
   (:require [hyprclj.elements :as el]
-            [hyprclj.dsl :as dsl]))
+            [hyprclj.dsl :as dsl]
+            [hyprclj.reactive :as r]))
 
 ;; Track reactive components
 (defonce ^:private reactive-components (atom {}))
 
-;; Dynamic var for tracking atom reads
-(def ^:dynamic *tracking-derefs* nil)
-
 (defn track-derefs
-  "Execute f and track all atom derefs within it.
-   Returns [result derefed-atoms]."
+  "Execute f and track the ratoms/reactions it derefs.
+   Returns [result derefed-signals].
+   Same tracking as hyprclj.reactive: plain atoms are not tracked."
   [f]
-  (let [derefed (atom #{})]
-    (binding [*tracking-derefs* derefed]
-      (let [result (f)]
-        [result @derefed]))))
-
-;; Override deref behavior when tracking
-(defn deref-tracked [x]
-  (when (and *tracking-derefs* (instance? clojure.lang.Atom x))
-    (swap! *tracking-derefs* conj x))
+  (r/track-derefs f))
+
+(defn deref-tracked
+  "Deref x. Kept for older callers: signal reads are tracked by
+   track-derefs on their own, so this is a plain deref."
+  [x]
   (clojure.core/deref x))
 
-;; Monkey-patch deref for tracking (simple approach)
-(defmacro with-atom-tracking [& body]
-  `(let [original-deref# deref]
-     (with-redefs [deref deref-tracked]
-       ~@body)))
+(defmacro with-atom-tracking
+  "Evaluate body. Kept for older callers: tracking no longer redefines
+   deref (see track-derefs)."
+  [& body]
+  `(do ~@body))
 
 (defn reactive-component
   "Create a reactive component that auto-updates when dependencies change.
@@ -40,9 +36,11 @@
      component-fn - Function that returns Hiccup
 
    The component will:
-   1. Track what atoms it reads
-   2. Watch those atoms for changes
-   3. Automatically remount when any atom changes
+   1. Track what ratoms/reactions (signals) it reads
+   2. Watch those signals for changes
+   3. Automatically remount when any of them changes
+
+   Plain atoms are read but not tracked; use ratom for component state.
 
    Example:
      (reactive-component :counter
@@ -56,9 +54,7 @@
 
     ;; Function to render and mount
     (letfn [(render-and-mount! []
-              (let [[hiccup-tree new-deps] (binding [*tracking-derefs* (atom #{})]
-                                             (let [result (component-fn)]
-                                               [result @*tracking-derefs*]))]
+              (let [[hiccup-tree new-deps] (track-derefs component-fn)]
 
                 ;; Remove old watches
                 (doseq [old-dep (:deps @state)]
@@ -72,8 +68,10 @@
                         ;; Dependency changed - remount!
                         (render-and-mount!)))))
 
-                ;; Clear parent and remount
+                ;; Clear parent and remount, recycling the old root element
                 (el/clear-children! parent-elem)
+                (when-let [old-native (:native @state)]
+                  (el/release! old-native))
                 (let [compiled (dsl/compile-element hiccup-tree)]
                   (when compiled
                     (el/add-child! parent-elem compiled))
@@ -121,8 +119,8 @@
   "Define a reactive component function.
 
    Example:
-     (defreactive my-counter [counter-atom]
-       [:text (str \"Count: \" @counter-atom)])
+     (defreactive my-counter [counter]
+       [:text (str \"Count: \" @counter)])
 
    Usage:
      (reactive-component :my-counter parent (partial my-counter counter))"
@@ -0,0 +1,302 @@
+(ns hyprclj.signal
+  "Fine-grained reactivity: signals, computed values and effects.
+
+   A signal holds a value. A computed derives its value from the signals
+   it reads and recomputes only when one of them changes. An effect runs
+   side effects whenever the signals it reads change - bind! uses effects
+   to drive native element properties directly: no Hiccup, no diff.
+
+   Dependencies are tracked through a dynamic binding while a computed or
+   effect runs, so tracking is per-thread and costs nothing outside a
+   tracked run. Changes propagate in height order (sources first), so each
+   node recomputes at most once per change and never observes a
+   half-updated graph (glitch-free).
+
+   An exception thrown by a computed or effect while a change propagates
+   is printed ([SIGNAL] ...) and that node keeps its previous value; the
+   other dependents still update. When creating one (computed, effect,
+   bind!) the exception is thrown to the caller.
+
+   Signals implement IDeref, IAtom2 and IRef: deref, swap!, reset!,
+   swap-vals!, reset-vals! and add-watch work as on atoms. Update them
+   from the UI thread (hypr/post! from elsewhere) since effects touch
+   native elements."
+  (:require [hyprclj.elements :as el]
+            [hyprclj.color :as color])
+  (:import [java.util PriorityQueue Comparator]))
+
+;; Reads collected by the computed/effect currently running
+(def ^:dynamic ^:private *reads* nil)
+
+;; Nodes waiting to recompute during a propagation
+(def ^:dynamic ^:private *queue* nil)
+
+;; Sources changed inside a batch
+(def ^:dynamic ^:private *batch* nil)
+
+(declare read! write!)
+
+;; node is a volatile map:
+;;   :sources  - signals read on the last run (computed/effect only)
+;;   :sinks    - computeds/effects that read this signal
+;;   :height   - 0 for sources, 1 + max source height otherwise
+;;   :dirty?   - queued for recompute
+;;   :disposed? - effect/computed no longer runs
+(deftype Signal [value compute-fn node watches]
+  clojure.lang.IDeref
+  (deref [this] (read! this))
+
+  clojure.lang.IAtom2
+  (reset [this new-value] (write! this new-value))
+  (swap [this f] (write! this (f @value)))
+  (swap [this f x] (write! this (f @value x)))
+  (swap [this f x y] (write! this (f @value x y)))
+  (swap [this f x y args] (write! this (apply f @value x y args)))
+  (compareAndSet [this old-value new-value]
+    (if (identical? @value old-value)
+      (do (write! this new-value) true)
+      false))
+  (resetVals [this new-value]
+    (let [old-value @value]
+      [old-value (write! this new-value)]))
+  (swapVals [this f]
+    (let [old-value @value] [old-value (write! this (f old-value))]))
+  (swapVals [this f x]
+    (let [old-value @value] [old-value (write! this (f old-value x))]))
+  (swapVals [this f x y]
+    (let [old-value @value] [old-value (write! this (f old-value x y))]))
+  (swapVals [this f x y args]
+    (let [old-value @value] [old-value (write! this (apply f old-value x y args))]))
+
+  clojure.lang.IRef
+  (setValidator [_ _]
+    (throw (UnsupportedOperationException. "Signals do not support validators")))
+  (getValidator [_] nil)
+  (getWatches [_] @watches)
+  (addWatch [this k f] (swap! watches assoc k f) this)
+  (removeWatch [this k] (swap! watches dissoc k) this))
+
+(defn signal?
+  "Check if a value is a signal (source, computed or effect)."
+  [x]
+  (instance? Signal x))
+
+(defn- make-signal [value compute-fn]
+  (Signal. (volatile! value) compute-fn
+           (volatile! {:sources #{} :sinks #{} :height 0 :dirty? false})
+           (atom {})))
+
+(defn- node [^Signal s] @(.-node s))
+
+(defn- notify-watches [^Signal s old-value new-value]
+  (doseq [[k f] @(.-watches s)]
+    (f k s old-value new-value)))
+
+;; ===== Propagation =====
+
+;; Queue entries are [height signal]; the height is snapshotted on enqueue
+;; because a node's height may change while it sits in the queue
+(def ^:private by-height
+  (reify Comparator
+    (compare [_ a b]
+      (compare (nth a 0) (nth b 0)))))
+
+(defn- enqueue! [^PriorityQueue queue ^Signal s]
+  (let [{:keys [dirty? disposed? height]} (node s)]
+    (when-not (or dirty? disposed?)
+      (vswap! (.-node s) assoc :dirty? true)
+      (.add queue [height s]))))
+
+(defn- recompute!
+  "Re-run a computed or effect, re-linking the sources it read.
+   Queues its sinks when its value changed. When f throws, the node keeps
+   its previous value and sources, and is no longer dirty, so the next
+   change of a source runs it again."
+  [^Signal s]
+  (when-not (:disposed? (node s))
+    (try
+      (let [reads (volatile! #{})
+            new-value (binding [*reads* reads] ((.-compute-fn s)))
+            new-sources @reads
+            old-sources (:sources (node s))]
+        (doseq [^Signal src old-sources :when (not (new-sources src))]
+          (vswap! (.-node src) update :sinks disj s))
+        (doseq [^Signal src new-sources :when (not (old-sources src))]
+          (vswap! (.-node src) update :sinks conj s))
+        (vswap! (.-node s) assoc
+                :sources new-sources
+                :dirty? false
+                :height (inc (reduce max -1 (map #(:height (node %)) new-sources))))
+        (let [old-value @(.-value s)]
+          (when (not= old-value new-value)
+            (vreset! (.-value s) new-value)
+            (notify-watches s old-value new-value)
+            (when-let [queue *queue*]
+              (doseq [sink (:sinks (node s))]
+                (enqueue! queue sink))))))
+      (finally
+        (vswap! (.-node s) assoc :dirty? false)))))
+
+(defn- propagate!
+  "Recompute everything downstream of the changed sources, lowest height
+   first. Joins the running propagation when called from inside one."
+  [sources]
+  (if-let [queue *queue*]
+    (doseq [s sources, sink (:sinks (node s))]
+      (enqueue! queue sink))
+    (let [queue (PriorityQueue. 16 by-height)]
+      (binding [*queue* queue]
+        (doseq [s sources, sink (:sinks (node s))]
+          (enqueue! queue sink))
+        (loop []
+          (when-let [[_ s] (.poll queue)]
+            ;; Already recomputed if a read pulled it ahead of its turn.
+            ;; A failing node is reported and skipped; the rest of the
+            ;; queue still drains
+            (when (:dirty? (node s))
+              (try
+                (recompute! s)
+                (catch Exception e
+                  (println "[SIGNAL] Computed/effect failed:" (.getMessage e)))))
+            (recur)))))))
+
+(defn- read! [^Signal s]
+  ;; A computed read mid-propagation before its turn (its dependencies
+  ;; changed dynamically) is brought up to date first
+  (when (and (.-compute-fn s) (:dirty? (node s)))
+    (recompute! s))
+  (when-let [reads *reads*]
+    (vswap! reads conj s))
+  @(.-value s))
+
+(defn- write! [^Signal s new-value]
+  (when (.-compute-fn s)
+    (throw (IllegalStateException. "Cannot set a computed signal")))
+  (let [old-value @(.-value s)]
+    (when (not= old-value new-value)
+      (vreset! (.-value s) new-value)
+      (notify-watches s old-value new-value)
+      (if-let [changed *batch*]
+        (vswap! changed conj s)
+        (propagate! [s])))
+    new-value))
+
+;; ===== Public API =====
+
+(defn signal
+  "Create a source signal.
+
+   Example:
+     (def count (signal 0))
+     @count            ;; => 0
+     (swap! count inc) ;; dependents update"
+  [initial-value]
+  (make-signal initial-value nil))
+
+(defn computed
+  "Create a signal derived from other signals. f is re-run only when a
+   signal it read on its last run changes, and its dependents update only
+   when its result changes.
+
+   Example:
+     (def doubled (computed #(* 2 @count)))"
+  [f]
+  (doto (make-signal nil f)
+    (recompute!)))
+
+(defn effect
+  "Run f now and again whenever a signal it read changes.
+   Returns the effect; pass it to dispose! to stop it.
+
+   Example:
+     (effect #(println \"count is\" @count))"
+  [f]
+  (doto (make-signal nil (fn [] (f) nil))
+    (recompute!)))
+
+(defn dispose!
+  "Stop a computed or effect and unlink it from its sources."
+  [^Signal s]
+  (doseq [^Signal src (:sources (node s))]
+    (vswap! (.-node src) update :sinks disj s))
+  (vswap! (.-node s) assoc :sources #{} :disposed? true)
+  nil)
+
+(defn peek-value
+  "Read a signal's current value without tracking it as a dependency."
+  [^Signal s]
+  @(.-value s))
+
+(defn track
+  "Call f and collect the signals it reads.
+   Returns [result signals]."
+  [f]
+  (let [reads (volatile! #{})
+        result (binding [*reads* reads] (f))]
+    [result @reads]))
+
+(defn batch*
+  "Call f, deferring propagation until it returns, so dependents of
+   several changed signals update once."
+  [f]
+  (if *batch*
+    (f)
+    (let [changed (volatile! [])
+          result (binding [*batch* changed] (f))]
+      (when (seq @changed)
+        (propagate! @changed))
+      result)))
+
+(defmacro batch
+  "Evaluate body with propagation deferred until the end.
+
+   Example:
+     (batch
+       (reset! x 1)
+       (reset! y 2))  ; dependents of x and y run once"
+  [& body]
+  `(batch* (fn [] ~@body)))
+
+;; ===== Native property bindings =====
+
+(def ^:private prop-setters
+  {:content   el/set-content!
+   :font-size el/set-font-size!
+   :color     (fn [element c] (el/set-color! element (color/normalize-color c)))
+   :position  el/set-absolute-position!
+   :size      el/set-size!})
+
+(defn bind!
+  "Bind a native element property to a signal (or a fn reading signals).
+   When it changes only the property setter runs - the element is patched
+   in place.
+
+   Properties:
+     :content   - Text content
+     :font-size - Text font size
+     :color     - Text or rectangle color ([r g b a] or hex string)
+     :position  - [x y] absolute position (element in absolute mode)
+     :size      - [width height]
+
+   Returns the binding effect; dispose! it to unbind.
+
+   Example:
+     (def count (signal 0))
+     (bind! label :content #(str \"Count: \" @count))
+     (bind! swatch :color (computed #(if (neg? @count) \"#F00\" \"#0F0\")))"
+  [element prop source]
+  (let [setter (or (prop-setters prop)
+                   (throw (IllegalArgumentException.
+                            (str "Unbindable property: " prop))))]
+    (effect
+      (fn []
+        (setter element (if (signal? source) @source (source)))))))
+
+(comment
+  (def count (signal 0))
+  (def doubled (computed #(* 2 @count)))
+  (def log (effect #(println "count" @count "doubled" @doubled)))
+
+  (swap! count inc)   ;; prints once: count 1 doubled 2
+  (dispose! log)
+  )
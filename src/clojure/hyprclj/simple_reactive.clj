@@ -20,6 +20,7 @@
   [parent-elem atoms-vec component-fn]
 
   (let [watch-id (gensym "reactive-watch-")
+        remount-key (hypr/idle-key)
         current-element (atom nil)]  ; Track current mounted element
 
     ;; Function to remount with minimal flicker
@@ -41,7 +42,9 @@
                         (el/remove-child! parent-elem old-element))
 
                       ;; Track new element
-                      (reset! current-element new-compiled))))))]
+                      (reset! current-element new-compiled))))
+                ;; Several watched atoms changing at once remount once
+                {:key remount-key}))]
 
       ;; Initial mount
       (remount!)
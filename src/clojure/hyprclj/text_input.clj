@@ -1,16 +1,19 @@
 (ns hyprclj.text-input
   "High-level text input component with keyboard handling."
   (:require [hyprclj.elements :as el]
-            [hyprclj.dsl :as dsl]
-            [hyprclj.input :as input]
-            [hyprclj.simple-reactive :refer [reactive-mount!]]))
+            [hyprclj.input :as input]))
 
 (defn make-text-input
   "Create a text input component with full keyboard support.
 
+   Text lives in the textbox's native text model: keystrokes are applied
+   natively (cursor, selection, UTF-8) and the element is updated in
+   place - nothing is remounted. text-atom mirrors the text for readers
+   and is updated from the change callback.
+
    Args:
      parent      - Parent element to mount into
-     text-atom   - Atom to store the text
+     text-atom   - Atom mirroring the text
      opts        - Options map
 
    Options:
@@ -29,64 +32,44 @@
         :on-submit (fn [text] (println \"Submitted:\" text))
         :window window})"
   [parent text-atom {:keys [placeholder on-submit on-change size window]
-                     :or {placeholder \"\" size [300 40]}}]
-
-  (let [textbox-container (el/column-layout {})]
-
-    ;; Add container to parent
-    (el/add-child! parent textbox-container)
-
-    ;; Create reactive textbox that updates when text-atom changes
-    (reactive-mount! textbox-container [text-atom]
-      (fn []
-        (let [current-text @text-atom]
-          [:textbox {:placeholder placeholder
-                     :size size}])))
-
-    ;; Set up keyboard handler for this input
+                     :or {placeholder "" size [300 40]}}]
+
+  (let [textbox (el/textbox {:placeholder placeholder
+                             :initial-text (or @text-atom "")
+                             :size size
+                             :on-change (fn [text]
+                                          (reset! text-atom text)
+                                          (when on-change (on-change text)))
+                             :on-submit (fn [text]
+                                          (println "[Input] Submitted:" text)
+                                          (when on-submit (on-submit text)))})]
+
+    (el/add-child! parent textbox)
+
+    ;; Programmatic resets (e.g. clearing after submit) go to the native model
+    (add-watch text-atom [::sync textbox]
+      (fn [_ _ _ new-text]
+        (when (not= new-text (.getText textbox))
+          (.setText textbox (str new-text)))))
+
+    ;; Join the window's focus chain (Tab order) and focus on click.
+    ;; Keys then go straight to the native text model.
     (when window
-      (let [handle-key (fn [keycode pressed?]
-                         (when pressed?
-                           (cond
-                             ;; Enter - submit
-                             (= keycode input/KEY_ENTER)
-                             (do
-                               (when on-submit
-                                 (on-submit @text-atom))
-                               (println \"[Input] Submitted:\" @text-atom))
-
-                             ;; Backspace - delete last char
-                             (= keycode input/KEY_BACKSPACE)
-                             (do
-                               (swap! text-atom (fn [s]
-                                                  (if (seq s)
-                                                    (subs s 0 (dec (count s)))
-                                                    s)))
-                               (when on-change (on-change @text-atom)))
-
-                             ;; Escape - blur/unfocus
-                             (= keycode input/KEY_ESC)
-                             (input/blur!)
-
-                             ;; Regular character
-                             :else
-                             (when-let [ch (input/keycode->char keycode @input/shift-pressed)]
-                               (swap! text-atom str ch)
-                               (when on-change (on-change @text-atom))))))]
-
-        ;; Make textbox focusable - focus on click
-        (doto textbox-container
-          (el/set-mouse-handlers
-            (fn [_]
-              (println \"[Input] Textbox focused\")
-              (input/focus! textbox-container handle-key))
-            nil nil))))
-
-    textbox-container))
+      (input/add-focusable! window textbox)
+      (.setMouseHandlers textbox
+        (reify java.util.function.Consumer
+          (accept [_ _]
+            (println "[Input] Textbox focused")
+            (input/focus-element! window textbox)))
+        nil nil))
+
+    textbox))
 
 (defn setup-text-input-system!
-  \"Initialize keyboard routing for a window.
-   Call this once per window that uses text inputs.\"
+  "Initialize keyboard routing for a window.
+
+   Text inputs created with :window are dispatched natively and need no
+   setup; this routes keys for elements focused with input/focus!."
   [window]
   (input/route-keyboard-to-focused! window))
 
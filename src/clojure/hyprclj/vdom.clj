@@ -6,7 +6,10 @@
   (:require [hyprclj.elements :as el]
             [hyprclj.dsl :as dsl]
             [hyprclj.core :as hypr]
-            [clojure.set :as set]))
+            [hyprclj.reactive :as r])
+  (:import [java.util IdentityHashMap]
+           [java.util.concurrent ExecutorService Executors ThreadFactory]
+           [org.hyprclj.bindings Element]))
 
 ;; ===== VNode (Virtual Node) =====
 
@@ -16,7 +19,7 @@
 (defn container-element? [hiccup]
   (when (vector? hiccup)
     (let [tag (first hiccup)]
-      (contains? #{:v-box :h-box :column :row :box} tag))))
+      (contains? #{:v-box :h-box :column :row :box :scroll-area :scrollable} tag))))
 
 ;; Helper: Extract children from hiccup (handles props, :children prop)
 (defn extract-children [hiccup]
@@ -52,112 +55,309 @@
     (->VNode auto-key path hiccup native-elem nil)))
 
 ;; ===== Reconciliation =====
+;;
+;; Reconciliation runs in three phases:
+;;   1. diff   - pure: old vnodes + new Hiccup -> plan of :keep/:patch/:create ops
+;;   2. build  - create detached native elements for :create ops, one unit each
+;;   3. commit - attach/detach against the live tree, synchronously
+;;
+;; Only the build phase is expensive, and it never touches the live tree, so
+;; it can be split across frames (see reconcile-sliced!).
+
+(defn- child-spec
+  "Normalize a child form into something the reconciler can diff: an
+   expanded Hiccup vector, a pre-built Element, or nil to skip it."
+  [child]
+  (cond
+    (vector? child) (dsl/expand-spec child)
+    (string? child) [:text {:content child}]
+    (instance? Element child) child
+    (r/reactive-atom? child) (child-spec @child)
+    :else nil))
+
+(defn- child-entries
+  "Pair each child with its key and path.
+   Keys come from ^{:key} metadata or are derived from path + tag."
+  [children path]
+  (into []
+        (keep-indexed
+          (fn [idx child]
+            (when-let [spec (child-spec child)]
+              (let [child-path (conj path idx)]
+                {:key (or (:key (meta child))
+                          (hash [child-path (when (vector? child) (first child))]))
+                 :path child-path
+                 :hiccup spec}))))
+        children))
+
+(defn- spec-children [spec]
+  (when (vector? spec)
+    (nth (dsl/parse-spec spec) 2)))
+
+(defn- create-op
+  "Plan a new element. Containers are planned node by node so large
+   subtrees can be built incrementally."
+  [{:keys [key path hiccup]}]
+  (cond-> {:op :create :key key :path path :hiccup hiccup}
+    (container-element? hiccup)
+    (assoc :children (mapv create-op (child-entries (spec-children hiccup) path)))))
+
+(defn- same-container?
+  "True when the new spec is the same container with the same props as the
+   old vnode, so its native element can be kept and only children diffed."
+  [old-vnode new-hiccup]
+  (let [old-hiccup (:hiccup old-vnode)]
+    (and (:native-element old-vnode)
+         (some? (:child-vnodes old-vnode))
+         (vector? old-hiccup)
+         (container-element? new-hiccup)
+         (= (first old-hiccup) (first new-hiccup))
+         (= (second (dsl/parse-spec old-hiccup))
+            (second (dsl/parse-spec new-hiccup))))))
+
+(defn- redraw?
+  "True when the new spec is the same canvas as the old vnode with only
+   its :commands changed, so the commands can be re-uploaded in place
+   (the canvas diffs them natively)."
+  [old-vnode new-hiccup]
+  (let [old-hiccup (:hiccup old-vnode)]
+    (and (:native-element old-vnode)
+         (vector? old-hiccup)
+         (vector? new-hiccup)
+         (= :canvas (first old-hiccup) (first new-hiccup))
+         (= (dissoc (second (dsl/parse-spec old-hiccup)) :commands)
+            (dissoc (second (dsl/parse-spec new-hiccup)) :commands)))))
+
+(defn diff
+  "Diff old vnodes against a new list of Hiccup children.
+   Pure - touches no native state. Returns a plan:
+
+     {:ops     [op ...]     ; one per new child, in order
+      :removed [vnode ...]} ; old children to detach
+
+   Ops:
+     {:op :keep   :vnode v}         - unchanged, reuse as-is
+     {:op :patch  :vnode v :plan p} - same container, children diffed in p
+     {:op :redraw :vnode v}         - same canvas, new :commands uploaded
+     {:op :create :hiccup h}        - build a new element (:children for containers)"
+  [old-vnodes new-children path]
+  (let [old-by-key (into {} (map (juxt :key identity)) old-vnodes)
+        ops (mapv (fn [{:keys [key path hiccup] :as entry}]
+                    (if-let [old-vnode (old-by-key key)]
+                      (cond
+                        (or (identical? (:hiccup old-vnode) hiccup)
+                            (= (:hiccup old-vnode) hiccup))
+                        {:op :keep :key key :vnode old-vnode}
+
+                        (redraw? old-vnode hiccup)
+                        {:op :redraw :key key :path path :hiccup hiccup :vnode old-vnode}
+
+                        (same-container? old-vnode hiccup)
+                        {:op :patch :key key :path path :hiccup hiccup :vnode old-vnode
+                         :plan (diff (:child-vnodes old-vnode) (spec-children hiccup) path)}
+
+                        ;; Changed - rebuild, old element is removed on commit
+                        :else
+                        (create-op entry))
+                      (create-op entry)))
+                  (child-entries new-children path))
+        reused-keys (into #{} (comp (remove #(= :create (:op %))) (map :key)) ops)]
+    {:ops ops
+     :removed (filterv #(not (reused-keys (:key %))) old-vnodes)}))
+
+(defn- build-node
+  "Create the detached native element for a :create op.
+   Containers are created empty - their children are separate units."
+  [{:keys [hiccup children]}]
+  (cond
+    (instance? Element hiccup) hiccup
+    children (let [[tag props] (dsl/parse-spec hiccup)]
+               (dsl/compile-node tag props))
+    :else (dsl/compile-element hiccup)))
+
+(defn build-units
+  "Flatten a plan into build units (thunks), parents before children.
+
+   Each unit creates one element and records it in `built` (op -> element).
+   Children of a newly created container are attached to it as they are
+   built; the container itself is still detached, so a partially built
+   tree is never visible."
+  [plan ^IdentityHashMap built]
+  (letfn [(op-units [op parent-op]
+            (case (:op op)
+              (:keep :redraw) []
+              :patch (plan-units (:plan op))
+              :create (into [(fn []
+                               (let [elem (build-node op)]
+                                 (.put built op elem)
+                                 (when-let [parent (and parent-op (.get built parent-op))]
+                                   (when elem
+                                     (el/add-child! parent elem)))))]
+                            (mapcat #(op-units % op))
+                            (:children op))))
+          (plan-units [plan]
+            (into [] (mapcat #(op-units % nil)) (:ops plan)))]
+    (plan-units plan)))
+
+(defn- release-vnode!
+  "Release the native elements of a removed vnode subtree so the native
+   pools can recycle them. Pre-built Elements passed in as children belong
+   to the caller and are left alone."
+  [vnode]
+  (let [elem (:native-element vnode)]
+    (doseq [child (:child-vnodes vnode)]
+      (when-let [child-elem (:native-element child)]
+        (el/remove-child! elem child-elem))
+      (release-vnode! child))
+    (when (and elem (vector? (:hiccup vnode)))
+      (el/release! elem))))
+
+(defn- discard!
+  "Detach a removed vnode's element from its parent and release it."
+  [parent vnode]
+  (el/remove-child! parent (:native-element vnode))
+  (release-vnode! vnode))
+
+(defn- detach!
+  "Discard an old vnode now, or queue it on pending-cleanup so its element
+   stays visible until the next update (anti-flicker)."
+  [parent vnode pending-cleanup]
+  (if pending-cleanup
+    (swap! pending-cleanup conj [parent vnode])
+    (discard! parent vnode)))
+
+(defn- release-built!
+  "Release the elements of a build that is abandoned before its commit.
+   None of them is attached to the live tree (children only to their new
+   parents), so they go straight back to the native pools. Pre-built
+   Elements passed in as children belong to the caller and are left alone."
+  [^IdentityHashMap built]
+  (doseq [[op elem] built :when (and elem (vector? (:hiccup op)))]
+    (el/release! elem))
+  (.clear built))
+
+(defn- created-vnode [op ^IdentityHashMap built]
+  (->VNode (:key op) (:path op) (:hiccup op) (.get built op)
+           (when (:children op)
+             (mapv #(created-vnode % built) (:children op)))))
+
+(defn commit!
+  "Apply a built plan to a live parent element. Returns the new vnodes.
+
+   Native layouts can only append, so children are detached and re-added
+   from the first position where the new order differs from the old one.
+   Removed elements go last, after their replacements are in place."
+  [parent old-vnodes plan ^IdentityHashMap built pending-cleanup]
+  (let [vnodes (mapv (fn [op]
+                       (case (:op op)
+                         :keep (:vnode op)
+                         :patch (let [old-vnode (:vnode op)
+                                      elem (:native-element old-vnode)]
+                                  (->VNode (:key op) (:path op) (:hiccup op) elem
+                                           (commit! elem (:child-vnodes old-vnode) (:plan op)
+                                                    built pending-cleanup)))
+                         :redraw (let [elem (:native-element (:vnode op))]
+                                   (el/set-canvas-commands!
+                                     elem (:commands (second (dsl/parse-spec (:hiccup op)))))
+                                   (->VNode (:key op) (:path op) (:hiccup op) elem nil))
+                         :create (created-vnode op built)))
+                     (:ops plan))
+        removed (into [] (keep :native-element) (:removed plan))
+        removed? (set removed)
+        surviving (into [] (comp (keep :native-element) (remove removed?)) old-vnodes)
+        current (into [] (keep :native-element) vnodes)
+        prefix (count (take-while true? (map identical? surviving current)))]
+
+    ;; (println "[VDOM] Commit:" (count current) "children, re-adding" (- (count current) prefix)
+    ;;          "| Removed:" (count removed))
+
+    (doseq [elem (drop prefix surviving)]
+      (el/remove-child! parent elem))
+    (doseq [elem (drop prefix current)]
+      (el/add-child! parent elem))
+    (doseq [vnode (:removed plan) :when (:native-element vnode)]
+      (detach! parent vnode pending-cleanup))
+    vnodes))
+
+(defn apply-plan!
+  "Build and commit a diff plan synchronously. Returns the new vnodes."
+  [parent old-vnodes plan pending-cleanup]
+  (let [built (IdentityHashMap.)]
+    (run! #(%) (build-units plan built))
+    (commit! parent old-vnodes plan built pending-cleanup)))
+
+(defn apply-plan-sliced!
+  "Build a diff plan on the native frame scheduler, then commit it.
+
+   Build units run in the :idle lane, yielding whenever the frame budget is
+   spent and resuming next frame, so input stays responsive while a large
+   tree is built. Nothing is attached until every unit has run; the commit
+   then happens in one go.
+
+   Options:
+     :pending-cleanup - atom for deferred removal (see reconcile!)
+     :live?           - checked before every slice; when it returns false
+                        the job is abandoned and the elements it built so
+                        far are released
+     :on-commit       - called with the new vnodes after commit"
+  [parent old-vnodes plan {:keys [pending-cleanup live? on-commit]
+                           :or {live? (constantly true)
+                                on-commit identity}}]
+  (let [built (IdentityHashMap.)
+        units (volatile! (seq (build-units plan built)))]
+    (hypr/schedule! :idle
+      (fn []
+        (if (live?)
+          (loop []
+            (if-let [unit (first @units)]
+              (do
+                (unit)
+                (vswap! units next)
+                (if (hypr/should-yield?) true (recur)))
+              (do
+                (on-commit (commit! parent old-vnodes plan built pending-cleanup))
+                false)))
+          (do
+            (release-built! built)
+            false))))
+    nil))
 
 (defn reconcile!
-  "Reconcile old and new hiccup trees.
+  "Reconcile old vnodes against a new list of Hiccup children, synchronously.
 
    Strategy:
    - Match by key (user-provided or auto-generated)
    - Reuse unchanged elements
-   - Rebuild changed elements
-   - Add new, queue old for removal (triple buffer)
-   - IMPORTANT: Fully rebuild container if children reordered (accept cost)"
+   - Keep containers whose props are unchanged and reconcile their children
+   - Rebuild changed elements, add new, remove old (queued on
+     pending-cleanup when given - triple buffer)
+   - Reordering re-attaches existing elements instead of rebuilding them
+
+   Returns the new vnodes."
   ([parent old-vnodes new-hiccup-list path]
    (reconcile! parent old-vnodes new-hiccup-list path nil))
   ([parent old-vnodes new-hiccup-list path pending-cleanup]
-
-  (let [;; Build map of old vnodes by key
-        old-by-key (into {} (map (fn [v] [(:key v) v]) old-vnodes))
-
-        ;; Create vnodes for new hiccup (with auto-keys)
-        new-vnodes-with-keys (mapv (fn [idx hiccup]
-                                     (let [child-path (conj path idx)
-                                           user-key (:key (meta hiccup))
-                                           auto-key (or user-key (hash [child-path (first hiccup)]))]
-                                       {:key auto-key
-                                        :path child-path
-                                        :hiccup hiccup}))
-                                   (range)
-                                   new-hiccup-list)
-
-        ;; Determine changes
-        old-keys (set (keys old-by-key))
-        new-keys (set (map :key new-vnodes-with-keys))
-        new-key-order (mapv :key new-vnodes-with-keys)
-        old-key-order (mapv :key old-vnodes)
-
-        deleted-keys (set/difference old-keys new-keys)
-        added-keys (set/difference new-keys old-keys)
-        kept-keys (set/intersection old-keys new-keys)
-
-        ;; Check if order changed (even for kept items)
-        order-changed? (not= (filter kept-keys new-key-order)
-                            (filter kept-keys old-key-order))]
-
-    ;; (println "[superDOM] Reconcile:" (count old-vnodes) "old →" (count new-vnodes-with-keys) "new"
-    ;;          "| Added:" (count added-keys) "Deleted:" (count deleted-keys) "Kept:" (count kept-keys))
-
-    ;; If order changed, do full rebuild (simpler than complex reordering)
-    (if (and order-changed? (seq kept-keys))
-      (do
-        (println "[VDOM] ⚠️  Order changed → FULL REBUILD")
-        ;; Remove all old elements
-        (doseq [vnode old-vnodes]
-          (when (:native-element vnode)
-            (el/remove-child! parent (:native-element vnode))))
-        ;; Create all new elements
-        (mapv (fn [{:keys [key path hiccup]}]
-                (println "[VDOM]   ✨ Create key" key)
-                (let [native-elem (dsl/compile-element hiccup)]
-                  (when native-elem
-                    (el/add-child! parent native-elem))
-                  ;; Track empty child-vnodes for containers (filled on first update)
-                  (->VNode key path hiccup native-elem (when (container-element? hiccup) []))))
-              new-vnodes-with-keys))
-
-      ;; Order unchanged - smart reconcile
-      (do
-        ;; Remove deleted (queue for triple buffer if provided)
-        (doseq [k deleted-keys]
-          (println "[VDOM]   🗑️  Delete key" k)
-          (when-let [old-vnode (old-by-key k)]
-            (when (:native-element old-vnode)
-              (if pending-cleanup
-                (swap! pending-cleanup conj (:native-element old-vnode))
-                (el/remove-child! parent (:native-element old-vnode))))))
-
-        ;; Process each new item
-        (mapv (fn [{:keys [key path hiccup]}]
-                (if (contains? kept-keys key)
-                  ;; Kept - check if changed
-                  (let [old-vnode (old-by-key key)
-                        old-hiccup (:hiccup old-vnode)]
-                    (if (= old-hiccup hiccup)
-                      ;; Unchanged - reuse!
-                      (do
-                        (println "[VDOM]   ♻️  Reuse key" key)
-                        old-vnode)
-                      ;; Changed - rebuild with delayed removal (anti-flicker)
-                      (do
-                        (println "[superDOM]    Rebuild key" key)
-                        (let [old-elem (:native-element old-vnode)
-                              new-elem (dsl/compile-element hiccup)]
-                          ;; DOUBLE BUFFER: Add new, then async remove old
-                          (when new-elem (el/add-child! parent new-elem))
-                          (when old-elem
-                            (hypr/add-idle! #(el/remove-child! parent old-elem)))
-                          (->VNode key path hiccup new-elem nil)))))
-                  ;; Added - create new
-                  ;; NOTE: dsl/compile-element already adds children, so we don't reconcile!
-                  ;; We only track that this is a new container for future reconciliations.
-                  (do
-                    (println "[VDOM]   ✨ Add key" key)
-                    (let [native-elem (dsl/compile-element hiccup)]
-                      (when native-elem
-                        (el/add-child! parent native-elem))
-                      ;; For containers, track empty child-vnodes (will be filled on first update)
-                      (->VNode key path hiccup native-elem (when (container-element? hiccup) []))))))
-              new-vnodes-with-keys))))))
+   (apply-plan! parent old-vnodes (diff old-vnodes new-hiccup-list path) pending-cleanup)))
+
+(defn reconcile-sliced!
+  "Time-sliced reconcile: diffs immediately, then builds and commits the
+   plan on the native frame scheduler. Takes the same options as
+   apply-plan-sliced!. Returns nil."
+  [parent old-vnodes new-hiccup-list path opts]
+  (apply-plan-sliced! parent old-vnodes (diff old-vnodes new-hiccup-list path) opts))
+
+;; ===== Off-thread rendering =====
+
+;; render-fn calls and diffs for :off-thread? mounts. Daemon threads so an
+;; idle pool never keeps the JVM alive.
+(defonce ^:private render-pool
+  (delay
+    (Executors/newFixedThreadPool
+      (max 1 (dec (.availableProcessors (Runtime/getRuntime))))
+      (reify ThreadFactory
+        (newThread [_ runnable]
+          (doto (Thread. ^Runnable runnable "hyprclj-vdom-render")
+            (.setDaemon true)))))))
 
 ;; ===== Main VDOM Mount =====
 
@@ -171,6 +371,20 @@
      app-state - Single atom containing all app state
      render-fn - Pure function: (fn [state [width height]] hiccup)
      window - Window (for resize handling)
+     opts - Optional map with:
+            :time-slice? - Build state updates in frame-sized slices on the
+                           native scheduler instead of in one go. Keeps input
+                           responsive while large trees re-render; a newer
+                           state abandons an in-flight build.
+            :off-thread? - Call render-fn and diff on a worker pool against
+                           an immutable state snapshot; only the resulting
+                           patch is applied on the UI thread. Results for
+                           superseded states are discarded. render-fn must
+                           then return plain Hiccup (no native elements).
+            :native-resize? - Don't re-render on window resize. For trees
+                              sized with percent / :fill specs the native
+                              containers relayout on their own; render-fn
+                              sees the new size on the next state change.
 
    Example:
      (def app-state (atom {:count 0}))
@@ -182,53 +396,100 @@
            [:button {:label \"+\" :on-click #(swap! app-state update :count inc)}]])
        window)"
   ([parent app-state render-fn window]
+   (vdom-mount! parent app-state render-fn window {}))
+  ([parent app-state render-fn window {:keys [time-slice? off-thread? native-resize?]}]
    (let [current-vnodes (atom [])
-         pending-cleanup (atom [])  ; Elements to remove on next update (triple buffer!)
-         window-size (atom [700 500])]  ; Default, updated on resize
-
-     ;; Watch app-state for data changes
-     (add-watch app-state :vdom-reconcile
-       (fn [_ _ old-state new-state]
-         (when (not= old-state new-state)
-           ;(println "[VDOM]  State changed" (keys (filter (fn [[k v]] (not= (get old-state k) v)) new-state)))
-           ;; TRIPLE BUFFER: Clean up elements from PREVIOUS update first
-           (when (seq @pending-cleanup)
-             ;(println "[VDOM] 🧹 Cleanup" (count @pending-cleanup) "old elements from previous update")
-             (doseq [elem @pending-cleanup]
-               (el/remove-child! parent elem))
-             (reset! pending-cleanup []))
-           ;; Now reconcile (will queue new elements for cleanup)
-           (let [new-hiccup (render-fn new-state @window-size)
-                 new-vnodes (reconcile! parent @current-vnodes [new-hiccup] [] pending-cleanup)]
-             (reset! current-vnodes new-vnodes)))))
-
-     ;; Enable window resize support (directly reconcile, don't use enable-responsive-root!)
-     (.setResizeListener window
-       (reify org.hyprclj.bindings.Window$ResizeListener
-         (onResize [_ width height]
-           (when (and (pos? width) (pos? height))
-             (let [new-size [width height]]
-               (when (not= new-size @window-size)
-                 (println "[VDOM] 📐 Window resized to" width "x" height)
-                 (reset! window-size new-size)
-                 ;; Full re-render on resize (all dimensions change!)
-                 (let [new-hiccup (render-fn @app-state new-size)
-                       new-vnodes (reconcile! parent @current-vnodes [new-hiccup] [])]
-                   (reset! current-vnodes new-vnodes))))))))
-
-     ;; Initial render
-     (println "[VDOM] 🎬 Initial render with size:" @window-size)
-     (let [initial-hiccup (render-fn @app-state @window-size)
-           initial-vnodes (reconcile! parent @current-vnodes [initial-hiccup] [])]
-       (println "[VDOM] ✅ Initial render complete -" (count initial-vnodes) "root vnodes")
-       (println "[VDOM] 🌳 VNode tree structure:")
-       (print-vnode-tree initial-vnodes)
-       (reset! current-vnodes initial-vnodes))
-
-     ;; Return cleanup function
-     (fn cleanup! []
-       (remove-watch app-state :vdom-reconcile)
-       (remove-watch window-size :vdom-resize)))))
+         pending-cleanup (atom [])  ; [parent vnode] pairs to remove on next update (triple buffer!)
+         window-size (atom [700 500])  ; Default, updated on resize
+         render-gen (atom 0)]  ; Bumped per render; stale builds and patches bail out
+
+     (letfn [(flush-cleanup! []
+               (when (seq @pending-cleanup)
+                 ;(println "[VDOM] 🧹 Cleanup" (count @pending-cleanup) "old elements from previous update")
+                 (doseq [[elem-parent vnode] @pending-cleanup]
+                   (discard! elem-parent vnode))
+                 (reset! pending-cleanup [])))
+             (apply-render! [gen base plan cleanup]
+               (if time-slice?
+                 (apply-plan-sliced! parent base plan
+                                     {:pending-cleanup cleanup
+                                      :live? #(= gen @render-gen)
+                                      :on-commit #(reset! current-vnodes %)})
+                 (reset! current-vnodes (apply-plan! parent base plan cleanup))))
+             (submit-render! [gen state size cleanup]
+               ;; Worker: render + diff against the committed vnodes snapshot
+               (.execute ^ExecutorService @render-pool
+                 (fn []
+                   (try
+                     (when (= gen @render-gen)
+                       (let [base @current-vnodes
+                             plan (diff base [(render-fn state size)] [])]
+                         ;; UI thread: apply only if still the latest render
+                         (hypr/post!
+                           (fn []
+                             (cond
+                               ;; A newer state is already on its way
+                               (not= gen @render-gen) nil
+
+                               (identical? base @current-vnodes)
+                               (do
+                                 (when cleanup (flush-cleanup!))
+                                 (apply-render! gen base plan cleanup))
+
+                               ;; Tree changed underneath the diff - redo it
+                               :else
+                               (submit-render! gen state size cleanup))))))
+                     (catch Exception e
+                       (println "[VDOM] Render failed:" (.getMessage e)))))))
+             (render! [state size cleanup]
+               (let [gen (swap! render-gen inc)]
+                 (if off-thread?
+                   (submit-render! gen state size cleanup)
+                   (do
+                     ;; TRIPLE BUFFER: Clean up elements from PREVIOUS update first
+                     (when cleanup (flush-cleanup!))
+                     (apply-render! gen @current-vnodes
+                                    (diff @current-vnodes [(render-fn state size)] [])
+                                    cleanup)))))]
+
+       ;; Watch app-state for data changes
+       (add-watch app-state :vdom-reconcile
+         (fn [_ _ old-state new-state]
+           (when (not= old-state new-state)
+             ;; Reconcile (flushes the previous update's cleanup, queues this one's)
+             (render! new-state @window-size pending-cleanup))))
+
+       ;; Enable window resize support (directly reconcile, don't use enable-responsive-root!)
+       (.setResizeListener window
+         (reify org.hyprclj.bindings.Window$ResizeListener
+           (onResize [_ width height]
+             (when (and (pos? width) (pos? height))
+               (let [new-size [width height]]
+                 (when (not= new-size @window-size)
+                   (println "[VDOM] 📐 Window resized to" width "x" height)
+                   (reset! window-size new-size)
+                   ;; Full re-render on resize (all dimensions change!)
+                   ;; Always synchronous - we are already on the UI thread
+                   (when-not native-resize?
+                     (swap! render-gen inc)
+                     (reset! current-vnodes
+                             (reconcile! parent @current-vnodes
+                                         [(render-fn @app-state new-size)] [])))))))))
+
+       ;; Initial render
+       (println "[VDOM] 🎬 Initial render with size:" @window-size)
+       (let [initial-hiccup (render-fn @app-state @window-size)
+             initial-vnodes (reconcile! parent @current-vnodes [initial-hiccup] [])]
+         (println "[VDOM] ✅ Initial render complete -" (count initial-vnodes) "root vnodes")
+         (println "[VDOM] 🌳 VNode tree structure:")
+         (print-vnode-tree initial-vnodes)
+         (reset! current-vnodes initial-vnodes))
+
+       ;; Return cleanup function
+       (fn cleanup! []
+         (swap! render-gen inc)
+         (remove-watch app-state :vdom-reconcile)
+         (remove-watch window-size :vdom-resize))))))
 
 ;; ===== Simplified API =====
 
@@ -1,5 +1,9 @@
 package org.hyprclj.bindings;
 
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicLong;
+
 /**
  * Wrapper for Hyprtoolkit IBackend.
  * Manages the event loop, timers, and system resources.
@@ -8,10 +12,56 @@ public class Backend {
     private long nativeHandle; // C++ pointer
     private static Backend instance;
 
+    // Work posted from other threads, drained on the UI thread
+    private final ConcurrentLinkedQueue<Runnable> posted = new ConcurrentLinkedQueue<>();
+    private final AtomicBoolean wakeupPending = new AtomicBoolean(false);
+    private static final AtomicLong idleKeys = new AtomicLong();
+
+    /**
+     * Scheduler lanes, highest priority first.
+     */
+    public static final int LANE_INPUT = 0;
+    public static final int LANE_TIMER = 1;
+    public static final int LANE_IDLE = 2;
+
+    /**
+     * A resumable unit of scheduled work.
+     */
+    public interface Task {
+        /**
+         * Run one slice of work, checking {@link Backend#shouldYield()} as it goes.
+         * @return true if work remains and the task should resume next frame
+         */
+        boolean run();
+    }
+
+    /**
+     * File descriptor readiness bits for {@link FdHandler}.
+     */
+    public static final int FD_READABLE = 1;
+    public static final int FD_HANGUP = 2;
+    public static final int FD_ERROR = 4;
+
+    /**
+     * Called on the UI thread when a watched file descriptor is ready.
+     */
+    public interface FdHandler {
+        /**
+         * @param fd The ready file descriptor
+         * @param events FD_* bits that are ready
+         */
+        void onReady(int fd, int events);
+    }
+
     private Backend(long handle) {
         this.nativeHandle = handle;
     }
 
+    // For natives driven by the backend's timers (Palette animations)
+    long handle() {
+        return nativeHandle;
+    }
+
     /**
      * Create the backend instance. Only one per process.
      */
@@ -22,6 +72,7 @@ public class Backend {
                 throw new RuntimeException("Failed to create backend");
             }
             instance = new Backend(handle);
+            instance.nativeInitPost(handle);
         }
         return instance;
     }
@@ -34,20 +85,169 @@ public class Backend {
     }
 
     /**
-     * Add a timer that fires after the specified milliseconds.
+     * Add a one-shot timer that fires after the specified milliseconds.
      * @param timeoutMs Timeout in milliseconds
      * @param callback Callback to invoke
+     * @return Timer handle for {@link #cancelTimer(long)}
+     */
+    public long addTimer(int timeoutMs, Runnable callback) {
+        return addTimer(timeoutMs, 0, 0, callback);
+    }
+
+    /**
+     * Add a timer on the native timing wheel.
+     * A timer with slack may fire up to slackMs late, so timers with
+     * similar deadlines share one loop wakeup.
+     * @param delayMs Delay before the first run
+     * @param intervalMs Repeat interval, or 0 for a one-shot timer
+     * @param slackMs How late the timer may fire, 0 for exact
+     * @param callback Callback to invoke
+     * @return Timer handle for {@link #cancelTimer(long)}, 0 on failure
+     */
+    public long addTimer(int delayMs, int intervalMs, int slackMs, Runnable callback) {
+        return nativeTimerAdd(nativeHandle, delayMs, intervalMs, slackMs, callback);
+    }
+
+    /**
+     * Add a repeating timer, first firing after one interval.
+     * Runs keep to the original schedule; missed periods are skipped.
+     * @param intervalMs Repeat interval in milliseconds
+     * @param callback Callback to invoke
+     * @return Timer handle for {@link #cancelTimer(long)}
+     */
+    public long setInterval(int intervalMs, Runnable callback) {
+        return addTimer(intervalMs, intervalMs, 0, callback);
+    }
+
+    /**
+     * Cancel a pending or repeating timer. Stale handles are ignored.
+     * @param timer Handle returned by addTimer or setInterval
+     * @return true if the timer was pending
+     */
+    public boolean cancelTimer(long timer) {
+        return nativeTimerCancel(timer);
+    }
+
+    /**
+     * Timer statistics: {active timers, loop wakeups, callbacks fired}.
      */
-    public void addTimer(int timeoutMs, Runnable callback) {
-        nativeAddTimer(nativeHandle, timeoutMs, callback);
+    public long[] timerStats() {
+        return nativeTimerStats();
     }
 
     /**
      * Add an idle callback that runs after pending events.
+     * Idle callbacks run in FIFO order from one native idle queue.
      * @param callback Callback to invoke
      */
     public void addIdle(Runnable callback) {
-        nativeAddIdle(nativeHandle, callback);
+        nativeAddIdle(nativeHandle, 0, callback);
+    }
+
+    /**
+     * Add a keyed idle callback. While a callback with the same key is
+     * still queued, it is replaced by this one (keeping its place in the
+     * queue), so repeated requests for the same work run once.
+     * @param key Key from {@link #newIdleKey()}, or 0 for no deduplication
+     * @param callback Callback to invoke
+     */
+    public void addIdle(long key, Runnable callback) {
+        nativeAddIdle(nativeHandle, key, callback);
+    }
+
+    /**
+     * Allocate a fresh key for {@link #addIdle(long, Runnable)}.
+     */
+    public static long newIdleKey() {
+        return idleKeys.incrementAndGet();
+    }
+
+    /**
+     * Set how long one idle drain may run before yielding to the event
+     * loop. Remaining callbacks run on the next idle. Default 8ms.
+     * @param budgetMs Budget in milliseconds
+     */
+    public void setIdleBudget(int budgetMs) {
+        nativeSetIdleBudget(budgetMs);
+    }
+
+    /**
+     * Watch a file descriptor in the event loop. The handler runs on the
+     * UI thread whenever the fd becomes ready, so pipes, sockets and
+     * inotify feeds push data instead of being polled.
+     * Hangups and errors are always reported, after which the watch is
+     * removed; drain the fd when FD_HANGUP is set.
+     * @param fd File descriptor, owned by the caller
+     * @param events FD_* bits to report; must include FD_READABLE (0 means
+     *     FD_READABLE), since the loop only waits for readability
+     * @param handler Handler to invoke
+     * @return false if the fd is invalid or already watched, or events
+     *     lacks FD_READABLE
+     */
+    public boolean addFd(int fd, int events, FdHandler handler) {
+        return nativeAddFd(nativeHandle, fd, events, handler);
+    }
+
+    /**
+     * Stop watching a file descriptor. Does not close it.
+     * @param fd File descriptor passed to addFd
+     * @return true if the fd was watched
+     */
+    public boolean removeFd(int fd) {
+        return nativeRemoveFd(nativeHandle, fd);
+    }
+
+    /**
+     * Run a callback on the UI thread. Safe to call from any thread.
+     * Callbacks run in FIFO order, batched into a single loop wakeup.
+     * @param callback Callback to invoke
+     */
+    public void post(Runnable callback) {
+        posted.add(callback);
+        if (wakeupPending.compareAndSet(false, true)) {
+            nativeWakeup();
+        }
+    }
+
+    // Called natively on the UI thread when the wakeup fd fires
+    private void drainPosted() {
+        wakeupPending.set(false);
+        Runnable callback;
+        while ((callback = posted.poll()) != null) {
+            try {
+                callback.run();
+            } catch (Throwable t) {
+                t.printStackTrace();
+            }
+        }
+    }
+
+    /**
+     * Schedule a resumable task on the native frame scheduler.
+     * Tasks run in lane order within a per-frame time budget and are
+     * resumed on the next frame until they return false.
+     * @param lane One of LANE_INPUT, LANE_TIMER, LANE_IDLE
+     * @param task Task to run
+     */
+    public void schedule(int lane, Task task) {
+        nativeSchedule(nativeHandle, lane, task);
+    }
+
+    /**
+     * Whether the current scheduler frame has used up its budget.
+     * Always false outside a scheduled task.
+     */
+    public boolean shouldYield() {
+        return nativeShouldYield();
+    }
+
+    /**
+     * Set the scheduler frame budget.
+     * @param budgetMs Time tasks may run per frame
+     * @param intervalMs Frame interval used to resume yielded work
+     */
+    public void setFrameBudget(int budgetMs, int intervalMs) {
+        nativeSetFrameBudget(budgetMs, intervalMs);
     }
 
     /**
@@ -77,8 +277,18 @@ public class Backend {
     // Native methods
     private static native long nativeCreate();
     private native void nativeEnterLoop(long handle);
-    private native void nativeAddTimer(long handle, int timeoutMs, Runnable callback);
-    private native void nativeAddIdle(long handle, Runnable callback);
+    private native long nativeTimerAdd(long handle, int delayMs, int intervalMs, int slackMs, Runnable callback);
+    private static native boolean nativeTimerCancel(long timer);
+    private static native long[] nativeTimerStats();
+    private native void nativeAddIdle(long handle, long key, Runnable callback);
+    private static native void nativeSetIdleBudget(int budgetMs);
+    private native boolean nativeAddFd(long handle, int fd, int events, FdHandler handler);
+    private native boolean nativeRemoveFd(long handle, int fd);
+    private native void nativeInitPost(long handle);
+    private static native void nativeWakeup();
+    private native void nativeSchedule(long handle, int lane, Task task);
+    private static native boolean nativeShouldYield();
+    private static native void nativeSetFrameBudget(int budgetMs, int intervalMs);
     private native void nativeDestroy(long handle);
 
     // Load native library
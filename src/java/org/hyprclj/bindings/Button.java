@@ -13,6 +13,7 @@ public class Button extends Element {
 
     public static class Builder {
         private String label = "";
+        private int labelId = Strings.NONE;
         private int width = -1;  // -1 means auto
         private int height = -1;
         private boolean noBorder = false;
@@ -23,6 +24,17 @@ public class Button extends Element {
 
         public Builder label(String label) {
             this.label = label;
+            this.labelId = Strings.NONE;
+            return this;
+        }
+
+        /**
+         * Set a label the UI repeats (e.g. in every row); it is interned
+         * and crosses to native as an id.
+         */
+        public Builder internedLabel(String label) {
+            this.label = label;
+            this.labelId = Strings.intern(label);
             return this;
         }
 
@@ -59,7 +71,7 @@ public class Button extends Element {
 
         public Button build() {
             long handle = nativeCreate(
-                label, width, height,
+                labelId == Strings.NONE ? label : null, labelId, width, height,
                 noBorder, noBg, fontSize
             );
             if (handle == 0) {
@@ -78,7 +90,7 @@ public class Button extends Element {
         }
 
         private static native long nativeCreate(
-            String label, int width, int height,
+            String label, int labelId, int width, int height,
             boolean noBorder, boolean noBg, int fontSize
         );
         private static native void nativeSetClickCallback(long handle, Runnable callback);
@@ -0,0 +1,71 @@
+package org.hyprclj.bindings;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Native canvas: draws a {@link DisplayList} of rects, polylines and text
+ * runs as one element. Uploads are diffed natively, so only commands that
+ * changed are redrawn. It is the only element that supports
+ * {@link Element#setCacheAsBitmap}.
+ */
+public class Canvas extends Element {
+
+    private int commandCount;
+
+    private Canvas(long handle) {
+        super(handle);
+    }
+
+    public static class Builder {
+        private int width = -1;  // -1 means auto (extent of the content)
+        private int height = -1;
+
+        /**
+         * Size specs, see {@link Size}.
+         */
+        public Builder size(int width, int height) {
+            this.width = width;
+            this.height = height;
+            return this;
+        }
+
+        public Canvas build() {
+            long handle = nativeCreate(width, height);
+            if (handle == 0) {
+                throw new RuntimeException("Failed to create canvas");
+            }
+            return new Canvas(handle);
+        }
+
+        private static native long nativeCreate(int width, int height);
+    }
+
+    public static Builder builder() {
+        return new Builder();
+    }
+
+    /**
+     * Replace the whole display list.
+     */
+    public void setCommands(DisplayList list) {
+        replaceCommands(0, -1, list);
+    }
+
+    /**
+     * Replace commands [from, to) with the commands of list; to = -1
+     * replaces through the end.
+     */
+    public void replaceCommands(int from, int to, DisplayList list) {
+        commandCount = nativeReplaceCommands(nativeHandle, from, to, list.buffer(), list.length());
+    }
+
+    public int commandCount() {
+        return commandCount;
+    }
+
+    private native int nativeReplaceCommands(long handle, int from, int to, ByteBuffer buffer, int length);
+
+    static {
+        System.loadLibrary("hyprclj");
+    }
+}
@@ -14,7 +14,7 @@ public class Checkbox extends Element {
     public static class Builder {
         private String label = "";
         private boolean checked = false;
-        private Consumer<Boolean> onChange;
+        private ToggleHandler onToggle;
 
         public Builder label(String label) {
             this.label = label;
@@ -27,19 +27,35 @@ public class Checkbox extends Element {
         }
 
         public Builder onChange(Consumer<Boolean> callback) {
-            this.onChange = callback;
+            // Boolean.valueOf returns the cached instances - still no allocation
+            this.onToggle = callback == null ? null : checked -> callback.accept(checked);
+            return this;
+        }
+
+        /**
+         * Toggle handler receiving the new state as a primitive.
+         */
+        public Builder onToggle(ToggleHandler handler) {
+            this.onToggle = handler;
             return this;
         }
 
         public Checkbox build() {
-            long handle = nativeCreate(label, checked, onChange);
+            long handle = nativeCreate(label, checked, onToggle);
             if (handle == 0) {
                 throw new RuntimeException("Failed to create checkbox");
             }
             return new Checkbox(handle);
         }
 
-        private static native long nativeCreate(String label, boolean checked, Consumer<Boolean> callback);
+        private static native long nativeCreate(String label, boolean checked, ToggleHandler callback);
+    }
+
+    /**
+     * Called natively with the new checked state.
+     */
+    public interface ToggleHandler {
+        void onToggle(boolean checked);
     }
 
     public static Builder builder() {
@@ -0,0 +1,51 @@
+package org.hyprclj.bindings;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+
+/**
+ * Column buffers for batch creation ({@link Rectangle#batch},
+ * {@link Text#batch}). A batch takes one int column per field, holding one
+ * value per element; native code reads direct buffers in place.
+ */
+public final class Columns {
+
+    private Columns() {
+    }
+
+    /**
+     * A zeroed direct column of count ints, in native byte order.
+     */
+    public static IntBuffer ints(int count) {
+        return ByteBuffer.allocateDirect(count * Integer.BYTES)
+            .order(ByteOrder.nativeOrder())
+            .asIntBuffer();
+    }
+
+    /**
+     * A direct column holding the given values.
+     */
+    public static IntBuffer of(int... values) {
+        IntBuffer column = ints(values.length);
+        column.put(values).flip();
+        return column;
+    }
+
+    /**
+     * The remaining values of a column as a direct native-order buffer
+     * starting at index 0, which is what native code reads: a slice of
+     * the column when it is direct and in native order, otherwise a copy.
+     */
+    public static IntBuffer direct(IntBuffer column) {
+        if (column == null) {
+            return null;
+        }
+        if (column.isDirect() && column.order() == ByteOrder.nativeOrder()) {
+            return column.slice();
+        }
+        IntBuffer copy = ints(column.remaining());
+        copy.put(column.duplicate()).flip();
+        return copy;
+    }
+}
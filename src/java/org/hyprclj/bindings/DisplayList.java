@@ -0,0 +1,153 @@
+package org.hyprclj.bindings;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.StandardCharsets;
+
+/**
+ * Drawing commands for a {@link Canvas}, encoded into one native-order
+ * direct buffer so a whole list uploads in a single call.
+ * Colors are packed 0xRRGGBBAA (see {@link #rgba}).
+ * Not thread-safe; reuse a list with {@link #clear()} between frames.
+ */
+public final class DisplayList {
+
+    // Keep in sync with eCanvasOp in hyprclj_canvas.cpp
+    static final int OP_RECT = 1;
+    static final int OP_POLYLINE = 2;
+    static final int OP_TEXT = 3;
+    static final int OP_CLIP = 4;
+    static final int OP_SAVE = 5;
+    static final int OP_RESTORE = 6;
+    static final int OP_TRANSLATE = 7;
+    static final int OP_SCALE = 8;
+
+    private ByteBuffer buffer;
+    private int count;
+
+    public DisplayList() {
+        this(4096);
+    }
+
+    public DisplayList(int capacity) {
+        buffer = ByteBuffer.allocateDirect(Math.max(capacity, 64)).order(ByteOrder.nativeOrder());
+    }
+
+    public static int rgba(int r, int g, int b, int a) {
+        return Flex.rgba(r, g, b, a);
+    }
+
+    /**
+     * Filled rectangle.
+     */
+    public DisplayList rect(float x, float y, float w, float h, int color) {
+        return rect(x, y, w, h, color, 0, 0, 0);
+    }
+
+    /**
+     * Rectangle with rounding and an optional border (thickness 0 for none).
+     */
+    public DisplayList rect(float x, float y, float w, float h, int color, float rounding, int borderColor, float border) {
+        begin(OP_RECT, 8);
+        buffer.putFloat(x).putFloat(y).putFloat(w).putFloat(h);
+        buffer.putInt(color).putFloat(rounding).putInt(borderColor).putFloat(border);
+        return this;
+    }
+
+    /**
+     * Polyline through flat {x0, y0, x1, y1, ...} points.
+     */
+    public DisplayList polyline(float[] points, int color, float thickness) {
+        int pairs = points.length / 2;
+        begin(OP_POLYLINE, 2 + pairs * 2);
+        buffer.putInt(color).putFloat(thickness);
+        for (int i = 0; i < pairs * 2; i++) {
+            buffer.putFloat(points[i]);
+        }
+        return this;
+    }
+
+    /**
+     * Text run with its top-left corner at (x, y).
+     */
+    public DisplayList text(float x, float y, String text, float fontSize, int color) {
+        byte[] utf8 = text.getBytes(StandardCharsets.UTF_8);
+        int padded = (utf8.length + 3) / 4;
+        begin(OP_TEXT, 5 + padded);
+        buffer.putFloat(x).putFloat(y).putInt(color).putFloat(fontSize).putInt(utf8.length);
+        buffer.put(utf8);
+        for (int i = utf8.length; i < padded * 4; i++) {
+            buffer.put((byte) 0);
+        }
+        return this;
+    }
+
+    /**
+     * Intersect the clip with a rectangle, until the matching restore().
+     */
+    public DisplayList clip(float x, float y, float w, float h) {
+        begin(OP_CLIP, 4);
+        buffer.putFloat(x).putFloat(y).putFloat(w).putFloat(h);
+        return this;
+    }
+
+    public DisplayList save() {
+        begin(OP_SAVE, 0);
+        return this;
+    }
+
+    public DisplayList restore() {
+        begin(OP_RESTORE, 0);
+        return this;
+    }
+
+    public DisplayList translate(float dx, float dy) {
+        begin(OP_TRANSLATE, 2);
+        buffer.putFloat(dx).putFloat(dy);
+        return this;
+    }
+
+    public DisplayList scale(float sx, float sy) {
+        begin(OP_SCALE, 2);
+        buffer.putFloat(sx).putFloat(sy);
+        return this;
+    }
+
+    public DisplayList clear() {
+        buffer.clear();
+        count = 0;
+        return this;
+    }
+
+    /**
+     * Number of commands, the unit of {@link Canvas#replaceCommands} ranges.
+     */
+    public int size() {
+        return count;
+    }
+
+    ByteBuffer buffer() {
+        return buffer;
+    }
+
+    int length() {
+        return buffer.position();
+    }
+
+    private void begin(int op, int words) {
+        ensure((1 + words) * 4);
+        buffer.putInt(op << 24 | words);
+        count++;
+    }
+
+    private void ensure(int bytes) {
+        if (buffer.remaining() >= bytes) {
+            return;
+        }
+        int capacity = Math.max(buffer.capacity() * 2, buffer.position() + bytes);
+        ByteBuffer grown = ByteBuffer.allocateDirect(capacity).order(ByteOrder.nativeOrder());
+        buffer.flip();
+        grown.put(buffer);
+        buffer = grown;
+    }
+}
@@ -56,19 +56,27 @@ public class Element {
 
     /**
      * Set the size of the element.
-     * @param width Width in pixels (-1 for auto)
-     * @param height Height in pixels (-1 for auto)
+     * @param width Width spec: pixels, or Size.percent / Size.AUTO / Size.FILL (-1 for auto)
+     * @param height Height spec, as width
      */
     public void setSize(int width, int height) {
         nativeSetSize(nativeHandle, width, height);
     }
 
+    /**
+     * Set minimum and maximum sizes in pixels, -1 for unconstrained.
+     * Honoured by native containers ({@link Flex}) when sizing this element.
+     */
+    public void setSizeConstraints(int minWidth, int minHeight, int maxWidth, int maxHeight) {
+        nativeSetSizeConstraints(nativeHandle, minWidth, minHeight, maxWidth, maxHeight);
+    }
+
     /**
      * Set alignment using position flags.
      * @param align "center", "left", "right", "top", "bottom", "hcenter", "vcenter"
      */
     public void setAlign(String align) {
-        nativeSetAlign(nativeHandle, align);
+        nativeSetAlign(nativeHandle, Strings.intern(align));
     }
 
     /**
@@ -89,7 +97,29 @@ public class Element {
     }
 
     /**
-     * Set mouse event handlers.
+     * Set how this element sizes inside a {@link Flex} container.
+     * Kept on the element, so it applies in whichever flex it is added to.
+     * @param grow Share of free main-axis space (0 = don't grow)
+     * @param shrink Share of overflow to give back, weighted by basis
+     * @param basis Main-axis size before growing, or -1 for the preferred size
+     * @param alignSelf Cross-axis alignment (Flex.ALIGN_*), ALIGN_AUTO for the container's
+     */
+    public void setFlexItem(float grow, float shrink, float basis, int alignSelf) {
+        nativeSetFlexItem(nativeHandle, grow, shrink, basis, alignSelf);
+    }
+
+    /**
+     * Place this element in a {@link Grid} cell. Pass -1 for row and/or
+     * column to let the grid place it in the next free cell.
+     * Alignment within the cell comes from alignSelf of {@link #setFlexItem}.
+     */
+    public void setGridCell(int row, int column, int rowSpan, int columnSpan) {
+        nativeSetGridCell(nativeHandle, row, column, rowSpan, columnSpan);
+    }
+
+    /**
+     * Set mouse event handlers. Each non-null handler is added to the
+     * element's mouse dispatcher; onClick fires on a press of any button.
      */
     public void setMouseHandlers(
         Consumer<MouseEvent> onClick,
@@ -107,10 +137,204 @@ public class Element {
         }
     }
 
+    /**
+     * Mouse handler with primitive arguments only, so dispatching an
+     * event allocates nothing. kind is one of the MOUSE_* constants;
+     * button is set for press/release events.
+     */
+    public interface MouseHandler {
+        void onMouse(double x, double y, int button, int kind);
+    }
+
+    public static final int MOUSE_PRESS = 0;
+    public static final int MOUSE_RELEASE = 1;
+    public static final int MOUSE_ENTER = 2;
+    public static final int MOUSE_LEAVE = 3;
+    public static final int MOUSE_MOVE = 4;
+    public static final int MOUSE_DOUBLE_CLICK = 5;
+
+    // Button mask bits for addMouseListener / addMouseAction
+    public static final int BUTTON_LEFT = 1;
+    public static final int BUTTON_RIGHT = 1 << 1;
+    public static final int BUTTON_MIDDLE = 1 << 2;
+    public static final int BUTTON_OTHER = 1 << 3;
+    public static final int BUTTON_ANY = 0xF;
+
+    /**
+     * Mask bit for an event kind, e.g.
+     * {@code kindMask(MOUSE_PRESS) | kindMask(MOUSE_DOUBLE_CLICK)}.
+     */
+    public static int kindMask(int kind) {
+        return 1 << kind;
+    }
+
+    /**
+     * Set a single handler for button, enter and leave events, replacing
+     * every mouse handler registered on this element. Positions are the
+     * last pointer position seen by the element.
+     * @param withMove also deliver MOUSE_MOVE events
+     */
+    public void setMouseHandler(MouseHandler handler, boolean withMove) {
+        nativeSetMouseHandler(nativeHandle, handler, withMove);
+    }
+
+    /**
+     * Subscribe a handler to some mouse events. Events are filtered
+     * natively, so the handler is only called for the kinds and buttons
+     * it asked for (buttons only apply to press, release and double-click).
+     * @param kinds kindMask bits
+     * @param buttons BUTTON_* mask
+     * @return subscription id for removeMouseListener
+     */
+    public int addMouseListener(int kinds, int buttons, MouseHandler handler) {
+        return nativeAddMouseListener(nativeHandle, kinds, buttons, handler);
+    }
+
+    /**
+     * Subscribe an action that needs no event data, e.g. a middle click:
+     * {@code addMouseAction(kindMask(MOUSE_PRESS), BUTTON_MIDDLE, action)}.
+     * @return subscription id for removeMouseListener
+     */
+    public int addMouseAction(int kinds, int buttons, Runnable action) {
+        return nativeAddMouseAction(nativeHandle, kinds, buttons, action);
+    }
+
+    /**
+     * Remove a mouse subscription.
+     */
+    public void removeMouseListener(int id) {
+        nativeRemoveMouseListener(nativeHandle, id);
+    }
+
+    /**
+     * Handler for events delegated by tagged descendants.
+     */
+    public interface DelegateHandler {
+        void onEvent(int tag, int kind, int button, double x, double y);
+    }
+
+    /**
+     * Handle the mouse events of all tagged descendants with one handler
+     * (event delegation). Pass null to stop delegating.
+     * @param kinds kindMask bits
+     * @param buttons BUTTON_* mask
+     */
+    public void setDelegateHandler(int kinds, int buttons, DelegateHandler handler) {
+        nativeSetDelegateHandler(nativeHandle, kinds, buttons, handler);
+    }
+
+    /**
+     * Tag this element: its mouse events are reported with this tag to
+     * the nearest delegating ancestor. The link to that ancestor is made
+     * by addChild, so tag before adding (or use tagChild).
+     */
+    public void setEventTag(int tag) {
+        nativeSetEventTag(nativeHandle, tag);
+    }
+
+    /**
+     * Tag a descendant and route its events to this container directly,
+     * wherever the descendant sits in the tree.
+     */
+    public void tagChild(Element child, int tag) {
+        nativeTagChild(nativeHandle, child.nativeHandle, tag);
+    }
+
     public long getNativeHandle() {
         return nativeHandle;
     }
 
+    /**
+     * Key handler called directly from native code while this element
+     * has focus. Return true to consume the event. The typed text is
+     * available from Window.keyText().
+     */
+    public interface KeyHandler {
+        boolean onKey(int keysym, boolean pressed, int modifiers);
+    }
+
+    /**
+     * Key handler that also receives the typed text (UTF-8 payload).
+     */
+    public interface TextKeyHandler {
+        boolean onKey(int keysym, boolean pressed, String utf8, int modifiers);
+    }
+
+    /**
+     * Set the key handler used while this element is focused
+     * (see Window.addFocusable). Pass null to remove it.
+     */
+    public void setKeyHandler(KeyHandler handler) {
+        nativeSetKeyHandler(nativeHandle, handler, false);
+    }
+
+    /**
+     * Set a key handler that needs the typed text.
+     */
+    public void setKeyHandler(TextKeyHandler handler) {
+        nativeSetKeyHandler(nativeHandle, handler, true);
+    }
+
+    /**
+     * Release this element. Buttons, texts and rectangles are reset and
+     * parked in a per-type pool for the next create call of the same
+     * shape; other elements are dropped. The element must already be
+     * detached from its parent and must not be used afterwards.
+     */
+    public void release() {
+        if (nativeHandle != 0) {
+            nativeRelease(nativeHandle);
+            nativeHandle = 0;
+        }
+    }
+
+    /**
+     * Element pool statistics: for button, text and rectangle (in that
+     * order) the number of parked elements, pool hits and pool misses.
+     */
+    public static long[] poolStats() {
+        return nativePoolStats();
+    }
+
+    /**
+     * Native layout statistics since startup: elements measured, measure
+     * cache hits, container relayouts and relayouts skipped (same box,
+     * nothing dirty).
+     */
+    public static long[] layoutStats() {
+        return nativeLayoutStats();
+    }
+
+    /**
+     * Cache this element's content as a bitmap: it is rasterized once at
+     * the window scale and shown as a single image until its content or
+     * size changes.
+     *
+     * <p>Only a {@link Canvas} can be cached, and only its rects and
+     * polylines; its text stays live. Returns false and changes nothing for
+     * any other element (text, rectangles, containers): their pixels come
+     * from hyprtoolkit's renderer, which can't be read back.
+     */
+    public boolean setCacheAsBitmap(boolean cache) {
+        return nativeSetCacheAsBitmap(nativeHandle, cache);
+    }
+
+    /**
+     * Bitmap cache statistics: cached bitmaps, bytes held, budget in
+     * bytes, reuses, rasterizations and evictions.
+     */
+    public static long[] bitmapCacheStats() {
+        return nativeBitmapCacheStats();
+    }
+
+    /**
+     * Set the memory budget for cached bitmaps in bytes (default 32 MiB).
+     * Least recently shown bitmaps are evicted to stay under it.
+     */
+    public static void setBitmapCacheBudget(long bytes) {
+        nativeSetBitmapCacheBudget(bytes);
+    }
+
     // Native methods
     private native void nativeAddChild(long handle, long childHandle);
     private native void nativeRemoveChild(long handle, long childHandle);
@@ -119,12 +343,29 @@ public class Element {
     private native void nativeSetGrow(long handle, boolean grow);
     private native void nativeSetGrowBoth(long handle, boolean growH, boolean growV);
     private native void nativeSetSize(long handle, int width, int height);
-    private native void nativeSetAlign(long handle, String align);
+    private native void nativeSetSizeConstraints(long handle, int minWidth, int minHeight, int maxWidth, int maxHeight);
+    private native void nativeSetAlign(long handle, int alignId);
     private native void nativeSetPositionMode(long handle, int mode);
     private native void nativeSetAbsolutePosition(long handle, int x, int y);
+    private native void nativeSetFlexItem(long handle, float grow, float shrink, float basis, int alignSelf);
+    private native void nativeSetGridCell(long handle, int row, int column, int rowSpan, int columnSpan);
     private native void nativeSetMouseClick(long handle, Consumer<MouseEvent> callback);
     private native void nativeSetMouseEnter(long handle, Consumer<MouseEvent> callback);
     private native void nativeSetMouseLeave(long handle, Consumer<MouseEvent> callback);
+    private native void nativeSetMouseHandler(long handle, MouseHandler handler, boolean withMove);
+    private native int nativeAddMouseListener(long handle, int kinds, int buttons, MouseHandler handler);
+    private native int nativeAddMouseAction(long handle, int kinds, int buttons, Runnable action);
+    private native void nativeRemoveMouseListener(long handle, int id);
+    private native void nativeSetDelegateHandler(long handle, int kinds, int buttons, DelegateHandler handler);
+    private native void nativeSetEventTag(long handle, int tag);
+    private native void nativeTagChild(long handle, long childHandle, int tag);
+    private native void nativeRelease(long handle);
+    private native void nativeSetKeyHandler(long handle, Object handler, boolean wantsText);
+    private static native long[] nativePoolStats();
+    private native boolean nativeSetCacheAsBitmap(long handle, boolean cache);
+    private static native long[] nativeLayoutStats();
+    private static native long[] nativeBitmapCacheStats();
+    private static native void nativeSetBitmapCacheBudget(long bytes);
 
     static {
         System.loadLibrary("hyprclj");
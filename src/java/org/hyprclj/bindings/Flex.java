@@ -0,0 +1,194 @@
+package org.hyprclj.bindings;
+
+/**
+ * Native flexbox container.
+ * Lays children out along one axis with justify / align, per-child
+ * grow, shrink and basis (see {@link Element#setFlexItem}), and draws its
+ * own background, border and rounding.
+ */
+public class Flex extends Element {
+
+    /**
+     * Main-axis distribution of free space.
+     */
+    public static final int JUSTIFY_START = 0;
+    public static final int JUSTIFY_CENTER = 1;
+    public static final int JUSTIFY_END = 2;
+    public static final int JUSTIFY_BETWEEN = 3;
+    public static final int JUSTIFY_AROUND = 4;
+    public static final int JUSTIFY_EVENLY = 5;
+
+    /**
+     * Cross-axis alignment. ALIGN_AUTO is only valid per child.
+     */
+    public static final int ALIGN_AUTO = -1;
+    public static final int ALIGN_START = 0;
+    public static final int ALIGN_CENTER = 1;
+    public static final int ALIGN_END = 2;
+    public static final int ALIGN_STRETCH = 3;
+
+    private int gap;
+    private int padding;
+    private int background;
+    private int borderColor;
+    private int border;
+    private int rounding;
+
+    private Flex(long handle, Builder builder) {
+        super(handle);
+        this.gap = builder.gap;
+        this.padding = builder.padding;
+        this.background = builder.background;
+        this.borderColor = builder.borderColor;
+        this.border = builder.border;
+        this.rounding = builder.rounding;
+    }
+
+    // Colors cross to native as 0xRRGGBBAA
+    static int rgba(int r, int g, int b, int a) {
+        return (r & 0xFF) << 24 | (g & 0xFF) << 16 | (b & 0xFF) << 8 | (a & 0xFF);
+    }
+
+    public static class Builder {
+        private boolean column = true;
+        private int justify = JUSTIFY_START;
+        private int align = ALIGN_START;
+        private int gap = 0;
+        private int padding = 0;
+        private int width = -1;  // -1 means auto
+        private int height = -1;
+        private int background = 0;  // Transparent
+        private int borderColor = 0;
+        private int border = 0;
+        private int rounding = 0;
+
+        public Builder column() {
+            this.column = true;
+            return this;
+        }
+
+        public Builder row() {
+            this.column = false;
+            return this;
+        }
+
+        public Builder justify(int justify) {
+            this.justify = justify;
+            return this;
+        }
+
+        public Builder align(int align) {
+            this.align = align;
+            return this;
+        }
+
+        public Builder gap(int gap) {
+            this.gap = gap;
+            return this;
+        }
+
+        public Builder padding(int padding) {
+            this.padding = padding;
+            return this;
+        }
+
+        /**
+         * Fixed size; pass -1 for an axis sized by content.
+         */
+        public Builder size(int width, int height) {
+            this.width = width;
+            this.height = height;
+            return this;
+        }
+
+        public Builder background(int r, int g, int b, int a) {
+            this.background = rgba(r, g, b, a);
+            return this;
+        }
+
+        public Builder border(int r, int g, int b, int a, int thickness) {
+            this.borderColor = rgba(r, g, b, a);
+            this.border = thickness;
+            return this;
+        }
+
+        public Builder rounding(int rounding) {
+            this.rounding = rounding;
+            return this;
+        }
+
+        public Flex build() {
+            long handle = nativeCreate(column, justify, align, gap, padding, width, height,
+                                       background, borderColor, border, rounding);
+            if (handle == 0) {
+                throw new RuntimeException("Failed to create flex container");
+            }
+            return new Flex(handle, this);
+        }
+
+        private static native long nativeCreate(
+            boolean column, int justify, int align, int gap, int padding,
+            int width, int height,
+            int background, int borderColor, int border, int rounding
+        );
+    }
+
+    public static Builder builder() {
+        return new Builder();
+    }
+
+    /**
+     * Lay children out vertically (true) or horizontally (false).
+     */
+    public void setColumn(boolean column) {
+        nativeSetDirection(nativeHandle, column);
+    }
+
+    public void setJustify(int justify) {
+        nativeSetJustify(nativeHandle, justify);
+    }
+
+    public void setAlignItems(int align) {
+        nativeSetAlignItems(nativeHandle, align);
+    }
+
+    public void setGap(int gap) {
+        this.gap = gap;
+        nativeSetGap(nativeHandle, gap, padding);
+    }
+
+    public void setPadding(int padding) {
+        this.padding = padding;
+        nativeSetGap(nativeHandle, gap, padding);
+    }
+
+    public void setBackground(int r, int g, int b, int a) {
+        this.background = rgba(r, g, b, a);
+        updateStyle();
+    }
+
+    public void setBorder(int r, int g, int b, int a, int thickness) {
+        this.borderColor = rgba(r, g, b, a);
+        this.border = thickness;
+        updateStyle();
+    }
+
+    public void setRounding(int rounding) {
+        this.rounding = rounding;
+        updateStyle();
+    }
+
+    private void updateStyle() {
+        nativeSetStyle(nativeHandle, background, borderColor, border, rounding);
+    }
+
+    private native void nativeSetDirection(long handle, boolean column);
+    private native void nativeSetJustify(long handle, int justify);
+    private native void nativeSetAlignItems(long handle, int align);
+    private native void nativeSetGap(long handle, int gap, int padding);
+    private native void nativeSetStyle(long handle, int background, int borderColor, int border, int rounding);
+
+    static {
+        System.loadLibrary("hyprclj");
+    }
+}
@@ -0,0 +1,201 @@
+package org.hyprclj.bindings;
+
+/**
+ * Native grid container.
+ * Places children in cells of fixed, fractional and auto row / column
+ * tracks, with spans and gaps (see {@link Element#setGridCell}), in one
+ * flat layout pass. Draws its own background, border and rounding.
+ */
+public class Grid extends Element {
+
+    // (kind << 24) | value; keep in sync with eTrackKind in hyprclj_grid.cpp
+    private static final int KIND_SHIFT = 24;
+    private static final int KIND_FR = 1;
+    private static final int KIND_AUTO = 2;
+    private static final int VALUE_MASK = (1 << KIND_SHIFT) - 1;
+
+    /**
+     * Track sized by its content.
+     */
+    public static final int AUTO = KIND_AUTO << KIND_SHIFT;
+
+    private int rowGap;
+    private int columnGap;
+    private int padding;
+    private int background;
+    private int borderColor;
+    private int border;
+    private int rounding;
+
+    private Grid(long handle, Builder builder) {
+        super(handle);
+        this.rowGap = builder.rowGap;
+        this.columnGap = builder.columnGap;
+        this.padding = builder.padding;
+        this.background = builder.background;
+        this.borderColor = builder.borderColor;
+        this.border = builder.border;
+        this.rounding = builder.rounding;
+    }
+
+    /**
+     * Fixed track in pixels.
+     */
+    public static int px(int pixels) {
+        return Math.max(0, Math.min(pixels, VALUE_MASK));
+    }
+
+    /**
+     * Fractional track: a share of the space the other tracks leave.
+     */
+    public static int fr(double weight) {
+        int hundredths = (int) Math.round(Math.max(0, weight) * 100);
+        return KIND_FR << KIND_SHIFT | Math.min(hundredths, VALUE_MASK);
+    }
+
+    public static class Builder {
+        private int[] columns = {};
+        private int[] rows = {};
+        private int rowGap = 0;
+        private int columnGap = 0;
+        private int align = Flex.ALIGN_STRETCH;
+        private int padding = 0;
+        private int width = -1;  // -1 means auto
+        private int height = -1;
+        private int background = 0;  // Transparent
+        private int borderColor = 0;
+        private int border = 0;
+        private int rounding = 0;
+
+        /**
+         * Column tracks (Grid.px / Grid.fr / Grid.AUTO).
+         */
+        public Builder columns(int... columns) {
+            this.columns = columns.clone();
+            return this;
+        }
+
+        /**
+         * Row tracks; rows beyond these are added as auto.
+         */
+        public Builder rows(int... rows) {
+            this.rows = rows.clone();
+            return this;
+        }
+
+        public Builder gap(int gap) {
+            return gap(gap, gap);
+        }
+
+        public Builder gap(int rowGap, int columnGap) {
+            this.rowGap = rowGap;
+            this.columnGap = columnGap;
+            return this;
+        }
+
+        /**
+         * Alignment of children within their cells (Flex.ALIGN_*).
+         */
+        public Builder align(int align) {
+            this.align = align;
+            return this;
+        }
+
+        public Builder padding(int padding) {
+            this.padding = padding;
+            return this;
+        }
+
+        /**
+         * Size specs, see {@link Size}.
+         */
+        public Builder size(int width, int height) {
+            this.width = width;
+            this.height = height;
+            return this;
+        }
+
+        public Builder background(int r, int g, int b, int a) {
+            this.background = Flex.rgba(r, g, b, a);
+            return this;
+        }
+
+        public Builder border(int r, int g, int b, int a, int thickness) {
+            this.borderColor = Flex.rgba(r, g, b, a);
+            this.border = thickness;
+            return this;
+        }
+
+        public Builder rounding(int rounding) {
+            this.rounding = rounding;
+            return this;
+        }
+
+        public Grid build() {
+            long handle = nativeCreate(columns, rows, rowGap, columnGap, align, padding, width, height,
+                                       background, borderColor, border, rounding);
+            if (handle == 0) {
+                throw new RuntimeException("Failed to create grid");
+            }
+            return new Grid(handle, this);
+        }
+
+        private static native long nativeCreate(
+            int[] columns, int[] rows, int rowGap, int columnGap, int align, int padding,
+            int width, int height,
+            int background, int borderColor, int border, int rounding
+        );
+    }
+
+    public static Builder builder() {
+        return new Builder();
+    }
+
+    public void setTracks(int[] columns, int[] rows) {
+        nativeSetTracks(nativeHandle, columns, rows);
+    }
+
+    public void setGap(int rowGap, int columnGap) {
+        this.rowGap = rowGap;
+        this.columnGap = columnGap;
+        nativeSetGap(nativeHandle, rowGap, columnGap, padding);
+    }
+
+    public void setPadding(int padding) {
+        this.padding = padding;
+        nativeSetGap(nativeHandle, rowGap, columnGap, padding);
+    }
+
+    public void setAlignItems(int align) {
+        nativeSetAlignItems(nativeHandle, align);
+    }
+
+    public void setBackground(int r, int g, int b, int a) {
+        this.background = Flex.rgba(r, g, b, a);
+        updateStyle();
+    }
+
+    public void setBorder(int r, int g, int b, int a, int thickness) {
+        this.borderColor = Flex.rgba(r, g, b, a);
+        this.border = thickness;
+        updateStyle();
+    }
+
+    public void setRounding(int rounding) {
+        this.rounding = rounding;
+        updateStyle();
+    }
+
+    private void updateStyle() {
+        nativeSetStyle(nativeHandle, background, borderColor, border, rounding);
+    }
+
+    private native void nativeSetTracks(long handle, int[] columns, int[] rows);
+    private native void nativeSetGap(long handle, int rowGap, int columnGap, int padding);
+    private native void nativeSetAlignItems(long handle, int align);
+    private native void nativeSetStyle(long handle, int background, int borderColor, int border, int rounding);
+
+    static {
+        System.loadLibrary("hyprclj");
+    }
+}
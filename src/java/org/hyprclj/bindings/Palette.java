@@ -0,0 +1,74 @@
+package org.hyprclj.bindings;
+
+/**
+ * Shared color slots. A slot holds one color natively; elements built
+ * with a slot reference read their color from it at paint time, so
+ * {@link #set} or {@link #animate} repaints every bound element without
+ * rebuilding any of them. Useful for themes and color animations.
+ *
+ * <p>Pass {@link #ref(int)} as the red component of a color
+ * ({@code builder.color(Palette.ref(slot), 0, 0, 0)}); the other
+ * components are ignored. Supported by {@link Text}, {@link Rectangle}
+ * (fill and border) and {@link Line}.
+ */
+public final class Palette {
+
+    private Palette() {
+    }
+
+    /**
+     * Create a slot holding a color. Slots live as long as the process.
+     * @return The slot id
+     */
+    public static int create(int r, int g, int b, int a) {
+        return nativeCreate(Flex.rgba(r, g, b, a));
+    }
+
+    /**
+     * The red component referring to a slot (negative, so it can't be
+     * mistaken for a color).
+     */
+    public static int ref(int slot) {
+        return -1 - slot;
+    }
+
+    /**
+     * Set a slot's color, stopping any animation, and repaint its elements.
+     */
+    public static void set(int slot, int r, int g, int b, int a) {
+        nativeSet(slot, Flex.rgba(r, g, b, a));
+    }
+
+    /**
+     * A slot's current color as 0xRRGGBBAA (mid-animation values included).
+     */
+    public static int get(int slot) {
+        return nativeGet(slot);
+    }
+
+    /**
+     * Animate a slot to a color, linearly over durationMs. Runs natively
+     * on the backend's timers; a new animation starts from the current
+     * color.
+     */
+    public static void animate(Backend backend, int slot, int r, int g, int b, int a, int durationMs) {
+        nativeAnimate(backend.handle(), slot, Flex.rgba(r, g, b, a), durationMs);
+    }
+
+    /**
+     * Palette statistics: slots, bound elements and element repaints.
+     */
+    public static long[] stats() {
+        return nativeStats();
+    }
+
+    private static native int nativeCreate(int rgba);
+    private static native void nativeSet(int slot, int rgba);
+    private static native int nativeGet(int slot);
+    private static native void nativeAnimate(long backendHandle, int slot, int rgba, int durationMs);
+    private static native long[] nativeStats();
+
+    static {
+        System.loadLibrary("hyprclj");
+    }
+}
@@ -1,5 +1,7 @@
 package org.hyprclj.bindings;
 
+import java.nio.IntBuffer;
+
 /**
  * Rectangle element for backgrounds and borders.
  */
@@ -80,6 +82,103 @@ public class Rectangle extends Element {
         return new Builder();
     }
 
+    /**
+     * Creates many rectangles in one native call from column buffers
+     * ({@link Columns}). Unset columns use the builder defaults; colors are
+     * packed 0xRRGGBBAA.
+     */
+    public static class Batch {
+        private final int count;
+        private IntBuffer colors, borderColors, borders, roundings;
+        private IntBuffer widths, heights, xs, ys;
+        private Element parent;
+
+        private Batch(int count) {
+            this.count = count;
+        }
+
+        public Batch colors(IntBuffer colors) {
+            this.colors = Columns.direct(colors);
+            return this;
+        }
+
+        public Batch borderColors(IntBuffer borderColors) {
+            this.borderColors = Columns.direct(borderColors);
+            return this;
+        }
+
+        public Batch borderThicknesses(IntBuffer borders) {
+            this.borders = Columns.direct(borders);
+            return this;
+        }
+
+        public Batch roundings(IntBuffer roundings) {
+            this.roundings = Columns.direct(roundings);
+            return this;
+        }
+
+        public Batch sizes(IntBuffer widths, IntBuffer heights) {
+            this.widths = Columns.direct(widths);
+            this.heights = Columns.direct(heights);
+            return this;
+        }
+
+        /**
+         * Place each rectangle absolutely at (x, y) in its parent.
+         */
+        public Batch positions(IntBuffer xs, IntBuffer ys) {
+            this.xs = Columns.direct(xs);
+            this.ys = Columns.direct(ys);
+            return this;
+        }
+
+        /**
+         * Add the rectangles to parent, with a single relayout.
+         */
+        public Batch parent(Element parent) {
+            this.parent = parent;
+            return this;
+        }
+
+        /**
+         * Create the elements. All or nothing: if any element fails, the
+         * ones already created are released, none is attached, and a
+         * RuntimeException is thrown. A column that is not direct or holds
+         * fewer than count values throws IllegalArgumentException.
+         */
+        public Rectangle[] build() {
+            long[] handles = nativeCreateMany(
+                parent == null ? 0 : parent.nativeHandle, count,
+                colors, borderColors, borders, roundings,
+                widths, heights, xs, ys
+            );
+            Rectangle[] rectangles = new Rectangle[handles.length];
+            for (int i = 0; i < handles.length; i++) {
+                rectangles[i] = new Rectangle(handles[i]);
+            }
+            return rectangles;
+        }
+
+        private static native long[] nativeCreateMany(
+            long parent, int count,
+            IntBuffer colors, IntBuffer borderColors, IntBuffer borders, IntBuffer roundings,
+            IntBuffer widths, IntBuffer heights, IntBuffer xs, IntBuffer ys
+        );
+    }
+
+    public static Batch batch(int count) {
+        return new Batch(count);
+    }
+
+    /**
+     * Update the fill color in place.
+     */
+    public void setColor(int r, int g, int b, int a) {
+        nativeSetColor(nativeHandle, r, g, b, a);
+    }
+
+    private native void nativeSetColor(long handle, int r, int g, int b, int a);
+
     static {
         System.loadLibrary("hyprclj");
     }
@@ -0,0 +1,47 @@
+package org.hyprclj.bindings;
+
+/**
+ * Size specs for builders' size(width, height) and {@link Element#setSize}.
+ * Each axis is one int: plain non-negative values are pixels, the helpers
+ * below encode the other modes. Percent and fill sizes are resolved
+ * natively against the parent on every relayout, so a window resize needs
+ * no re-render.
+ */
+public final class Size {
+
+    // (mode << 24) | value; keep in sync with eSizeMode in hyprclj_layout.hpp
+    private static final int MODE_SHIFT = 24;
+    private static final int MODE_PERCENT = 1;
+    private static final int MODE_AUTO = 2;
+    private static final int MODE_FILL = 3;
+    private static final int VALUE_MASK = (1 << MODE_SHIFT) - 1;
+
+    /**
+     * Sized by content. -1 is accepted as well.
+     */
+    public static final int AUTO = MODE_AUTO << MODE_SHIFT;
+
+    /**
+     * Fill the parent: grows into free space inside native containers,
+     * 100% of the parent in hyprtoolkit layouts.
+     */
+    public static final int FILL = MODE_FILL << MODE_SHIFT;
+
+    private Size() {
+    }
+
+    /**
+     * A fixed size in pixels.
+     */
+    public static int px(int pixels) {
+        return Math.max(0, Math.min(pixels, VALUE_MASK));
+    }
+
+    /**
+     * A percentage of the parent's size (0-100, fractional allowed).
+     */
+    public static int percent(double percent) {
+        int hundredths = (int) Math.round(Math.max(0, percent) * 100);
+        return MODE_PERCENT << MODE_SHIFT | Math.min(hundredths, VALUE_MASK);
+    }
+}
@@ -0,0 +1,53 @@
+package org.hyprclj.bindings;
+
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Native string interning. A string registered once crosses JNI as an int
+ * id afterwards, with no marshaling or allocation. Used for font families
+ * and align names, and for labels a UI repeats
+ * ({@link Text.Builder#internedContent}, {@link Button.Builder#internedLabel}).
+ *
+ * <p>Interned strings live as long as the process, so intern bounded sets,
+ * not arbitrary content.
+ */
+public final class Strings {
+
+    /**
+     * Id meaning "not interned".
+     */
+    public static final int NONE = -1;
+
+    private static final ConcurrentHashMap<String, Integer> ids = new ConcurrentHashMap<>();
+
+    private Strings() {
+    }
+
+    /**
+     * The id of a string, registering it natively on first use.
+     */
+    public static int intern(String s) {
+        if (s == null) {
+            return NONE;
+        }
+        Integer id = ids.get(s);
+        if (id != null) {
+            return id;
+        }
+        return ids.computeIfAbsent(s, Strings::nativeIntern);
+    }
+
+    /**
+     * Number of interned strings.
+     */
+    public static int count() {
+        return nativeCount();
+    }
+
+    private static native int nativeIntern(String s);
+    private static native int nativeCount();
+
+    static {
+        System.loadLibrary("hyprclj");
+    }
+}
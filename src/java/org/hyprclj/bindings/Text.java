@@ -1,5 +1,7 @@
 package org.hyprclj.bindings;
 
+import java.nio.IntBuffer;
+
 /**
  * Text element.
  */
@@ -11,6 +13,7 @@ public class Text extends Element {
 
     public static class Builder {
         private String content = "";
+        private int contentId = Strings.NONE;
         private int fontSize = 12;
         private String fontFamily = "";
         private int r = 255, g = 255, b = 255, a = 255;  // White by default
@@ -19,6 +22,17 @@ public class Text extends Element {
 
         public Builder content(String content) {
             this.content = content;
+            this.contentId = Strings.NONE;
+            return this;
+        }
+
+        /**
+         * Set content the UI repeats (e.g. a column label); it is interned
+         * and crosses to native as an id.
+         */
+        public Builder internedContent(String content) {
+            this.content = content;
+            this.contentId = Strings.intern(content);
             return this;
         }
 
@@ -56,8 +70,9 @@ public class Text extends Element {
 
         public Text build() {
             long handle = nativeCreate(
-                content, fontSize, fontFamily,
-                r, g, b, a, align, alpha
+                contentId == Strings.NONE ? content : null, contentId,
+                fontSize, Strings.intern(fontFamily),
+                r, g, b, a, Strings.intern(align), alpha
             );
             if (handle == 0) {
                 throw new RuntimeException("Failed to create text element");
@@ -66,8 +81,8 @@ public class Text extends Element {
         }
 
         private static native long nativeCreate(
-            String content, int fontSize, String fontFamily,
-            int r, int g, int b, int a, String align, float alpha
+            String content, int contentId, int fontSize, int fontFamilyId,
+            int r, int g, int b, int a, int alignId, float alpha
         );
     }
 
@@ -75,6 +90,110 @@ public class Text extends Element {
         return new Builder();
     }
 
+    /**
+     * Creates many text elements in one native call from column buffers
+     * ({@link Columns}). Unset columns use the builder defaults; colors are
+     * packed 0xRRGGBBAA. All elements share one font family.
+     */
+    public static class Batch {
+        private final int count;
+        private String[] contents;
+        private IntBuffer contentIds, fontSizes, colors, xs, ys;
+        private String fontFamily = "";
+        private Element parent;
+
+        private Batch(int count) {
+            this.count = count;
+        }
+
+        public Batch contents(String[] contents) {
+            this.contents = contents;
+            return this;
+        }
+
+        /**
+         * Set content the UI repeats (table headers, enum values); each
+         * distinct string is interned and crosses to native as an id.
+         */
+        public Batch internedContents(String[] contents) {
+            IntBuffer ids = Columns.ints(contents.length);
+            for (int i = 0; i < contents.length; i++) {
+                ids.put(i, Strings.intern(contents[i]));
+            }
+            return contentIds(ids);
+        }
+
+        /**
+         * Interned content ids ({@link Strings#intern}); an id of
+         * {@link Strings#NONE} falls back to contents[i].
+         */
+        public Batch contentIds(IntBuffer contentIds) {
+            this.contentIds = Columns.direct(contentIds);
+            return this;
+        }
+
+        public Batch fontFamily(String family) {
+            this.fontFamily = family;
+            return this;
+        }
+
+        public Batch fontSizes(IntBuffer fontSizes) {
+            this.fontSizes = Columns.direct(fontSizes);
+            return this;
+        }
+
+        public Batch colors(IntBuffer colors) {
+            this.colors = Columns.direct(colors);
+            return this;
+        }
+
+        /**
+         * Place each element absolutely at (x, y) in its parent.
+         */
+        public Batch positions(IntBuffer xs, IntBuffer ys) {
+            this.xs = Columns.direct(xs);
+            this.ys = Columns.direct(ys);
+            return this;
+        }
+
+        /**
+         * Add the elements to parent, with a single relayout.
+         */
+        public Batch parent(Element parent) {
+            this.parent = parent;
+            return this;
+        }
+
+        /**
+         * Create the elements. All or nothing: if any element fails, the
+         * ones already created are released, none is attached, and a
+         * RuntimeException is thrown. A column that is not direct or holds
+         * fewer than count values throws IllegalArgumentException.
+         */
+        public Text[] build() {
+            long[] handles = nativeCreateMany(
+                parent == null ? 0 : parent.nativeHandle, count,
+                contentIds, contents, Strings.intern(fontFamily),
+                fontSizes, colors, xs, ys
+            );
+            Text[] texts = new Text[handles.length];
+            for (int i = 0; i < handles.length; i++) {
+                texts[i] = new Text(handles[i]);
+            }
+            return texts;
+        }
+
+        private static native long[] nativeCreateMany(
+            long parent, int count,
+            IntBuffer contentIds, String[] contents, int fontFamilyId,
+            IntBuffer fontSizes, IntBuffer colors, IntBuffer xs, IntBuffer ys
+        );
+    }
+
+    public static Batch batch(int count) {
+        return new Batch(count);
+    }
+
     /**
      * Update the text content.
      */
@@ -89,8 +208,50 @@ public class Text extends Element {
         nativeSetFontSize(nativeHandle, size);
     }
 
+    /**
+     * Update the text color in place.
+     */
+    public void setColor(int r, int g, int b, int a) {
+        nativeSetColor(nativeHandle, r, g, b, a);
+    }
+
+    /**
+     * Measure text without creating an element, as {width, height} in
+     * pixels. Measurements are cached natively by (content, font, size,
+     * maxWidth) and shared with the layout of text elements.
+     * @param fontFamily Font family, or "" for the default
+     * @param maxWidth Width to lay out in, -1 for unbounded
+     */
+    public static double[] measure(String content, String fontFamily, int fontSize, int maxWidth) {
+        return nativeMeasure(content, Strings.intern(fontFamily), fontSize, maxWidth);
+    }
+
+    public static double[] measure(String content, String fontFamily, int fontSize) {
+        return measure(content, fontFamily, fontSize, -1);
+    }
+
+    /**
+     * Text measurement cache statistics: entries, bytes held, budget in
+     * bytes, hits, misses and evictions.
+     */
+    public static long[] measureStats() {
+        return nativeMeasureStats();
+    }
+
+    /**
+     * Set the memory budget of the text measurement cache in bytes
+     * (default 2 MiB).
+     */
+    public static void setMeasureCacheBudget(long bytes) {
+        nativeSetMeasureCacheBudget(bytes);
+    }
+
     private native void nativeSetContent(long handle, String content);
     private native void nativeSetFontSize(long handle, int size);
+    private native void nativeSetColor(long handle, int r, int g, int b, int a);
+    private static native double[] nativeMeasure(String content, int fontFamilyId, int fontSize, int maxWidth);
+    private static native long[] nativeMeasureStats();
+    private static native void nativeSetMeasureCacheBudget(long bytes);
 
     static {
         System.loadLibrary("hyprclj");
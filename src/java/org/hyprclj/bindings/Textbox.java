@@ -40,6 +40,11 @@ public class Textbox extends Element {
             return this;
         }
 
+        /**
+         * Called with the whole text after edits, at most once per frame
+         * (a burst of keys within a frame is reported once, with the
+         * latest text). Each call copies the full text: O(length).
+         */
         public Builder onChange(Consumer<String> callback) {
             this.onChange = callback;
             return this;
@@ -96,8 +101,30 @@ public class Textbox extends Element {
         setText("");
     }
 
+    /**
+     * Apply a keyboard event to the native text model (insert, delete,
+     * cursor movement, selection, submit). The edit itself is O(1); the
+     * element and the change callback are updated on the next frame, once
+     * for all edits made until then.
+     *
+     * @return true if the key was consumed
+     */
+    public boolean handleKey(int keysym, boolean pressed, String utf8, int modifiers) {
+        return nativeHandleKey(nativeHandle, keysym, pressed, utf8, modifiers);
+    }
+
+    /**
+     * Current selection as {start, end} UTF-8 byte offsets.
+     * start == end is a plain cursor.
+     */
+    public int[] getSelection() {
+        return nativeGetSelection(nativeHandle);
+    }
+
     private native String nativeGetText(long handle);
     private native void nativeSetText(long handle, String text);
+    private native boolean nativeHandleKey(long handle, int keysym, boolean pressed, String utf8, int modifiers);
+    private native int[] nativeGetSelection(long handle);
 
     static {
         System.loadLibrary("hyprclj");
@@ -1,5 +1,6 @@
 package org.hyprclj.bindings;
 
+import java.nio.ByteBuffer;
 import java.util.function.Consumer;
 
 /**
@@ -9,6 +10,7 @@ import java.util.function.Consumer;
 public class Window {
     private long nativeHandle;
     private Element rootElement;
+    private WindowState state;
     private long closeListenerHandle;  // Store close listener to prevent GC
 
     private Window(long handle) {
@@ -103,7 +105,7 @@ public class Window {
     }
 
     /**
-     * Close the window.
+     * Close the window. Its state page keeps its last values.
      */
     public void close() {
         nativeClose(nativeHandle);
@@ -134,6 +136,14 @@ public class Window {
         void onKey(int keyCode, boolean pressed, String utf8, int modifiers);
     }
 
+    /**
+     * Keyboard listener with primitive arguments only. Nothing is
+     * allocated per event; call keyText() for the typed text.
+     */
+    public interface KeyListener {
+        void onKey(int keysym, boolean pressed, int modifiers);
+    }
+
     /**
      * Set resize event listener for this window.
      */
@@ -142,12 +152,152 @@ public class Window {
     }
 
     /**
-     * Set keyboard event listener for this window.
+     * Set keyboard event listener for this window. It receives the events
+     * not consumed by focus traversal or the focused element.
      */
     public void setKeyboardListener(KeyboardListener listener) {
         nativeSetKeyboardCallback(nativeHandle, listener);
     }
 
+    /**
+     * Set an allocation-free keyboard listener. Replaces any
+     * KeyboardListener; receives the same unconsumed events.
+     */
+    public void setKeyListener(KeyListener listener) {
+        nativeSetKeyListener(nativeHandle, listener);
+    }
+
+    /**
+     * Text typed by the key event currently being dispatched, or null if
+     * it produced none. Only valid inside a KeyListener or Element
+     * KeyHandler callback; the string is built on demand.
+     */
+    public static String keyText() {
+        return nativeKeyText();
+    }
+
+    /**
+     * Bind a key sequence. Each step is a keysym plus modifier mask
+     * (Shift=1, Ctrl=4, Alt=8, Super=64); several steps form a chord
+     * such as Ctrl+X Ctrl+S. Matching happens natively and only a
+     * completed binding calls the action.
+     *
+     * @param onRelease fire on release of the final key instead of press
+     * @return binding id for unbindKeys
+     */
+    public int bindKeys(int[] keysyms, int[] modifiers, boolean onRelease, Runnable action) {
+        if (keysyms.length == 0 || keysyms.length != modifiers.length) {
+            throw new IllegalArgumentException("keysyms and modifiers must be non-empty and the same length");
+        }
+        return nativeBindKeys(nativeHandle, keysyms, modifiers, onRelease, action);
+    }
+
+    /**
+     * Bind a single key combination, fired on press.
+     */
+    public int bindKeys(int keysym, int modifiers, Runnable action) {
+        return bindKeys(new int[] {keysym}, new int[] {modifiers}, false, action);
+    }
+
+    /**
+     * Remove a binding returned by bindKeys.
+     */
+    public void unbindKeys(int id) {
+        nativeUnbindKeys(nativeHandle, id);
+    }
+
+    /**
+     * Whether events not consumed by bindings, focus traversal or the
+     * focused element are forwarded to the KeyboardListener. Enabled by
+     * setKeyboardListener; disable it to keep unbound keys out of Java.
+     */
+    public void setCatchAll(boolean enabled) {
+        nativeSetCatchAll(nativeHandle, enabled);
+    }
+
+    /**
+     * Append an element to this window's focus chain (Tab order).
+     * A focused Textbox edits its text natively; other elements receive
+     * keys through their Element key handler.
+     */
+    public void addFocusable(Element element) {
+        nativeAddFocusable(nativeHandle, element.getNativeHandle());
+    }
+
+    /**
+     * Remove an element from the focus chain.
+     */
+    public void removeFocusable(Element element) {
+        nativeRemoveFocusable(nativeHandle, element.getNativeHandle());
+    }
+
+    /**
+     * Give keyboard focus to an element.
+     */
+    public void focus(Element element) {
+        nativeFocus(nativeHandle, element == null ? 0 : element.getNativeHandle());
+    }
+
+    /**
+     * Clear keyboard focus.
+     */
+    public void blur() {
+        nativeFocus(nativeHandle, 0);
+    }
+
+    /**
+     * Move focus to the next element in the chain (same as Tab).
+     */
+    public void focusNext() {
+        nativeMoveFocus(nativeHandle, 1);
+    }
+
+    /**
+     * Move focus to the previous element in the chain (same as Shift+Tab).
+     */
+    public void focusPrev() {
+        nativeMoveFocus(nativeHandle, -1);
+    }
+
+    /**
+     * Shared state page of this window (size, scale, pointer, modifiers,
+     * focus, scroll offsets), kept up to date natively. Reading it needs
+     * no JNI call and allocates nothing.
+     */
+    public WindowState state() {
+        if (state == null) {
+            // Ours, so it outlives the window; native code writes to it
+            // until the window is closed
+            ByteBuffer page = ByteBuffer.allocateDirect(WindowState.PAGE_SIZE + 64).alignedSlice(64);
+            if (!nativeStatePage(nativeHandle, page)) {
+                throw new IllegalStateException("Window has no state page");
+            }
+            state = new WindowState(page);
+        }
+        return state;
+    }
+
+    /**
+     * Publish a scroll area's offsets in the state page.
+     * @return its slot for WindowState.scroll, or -1 if all slots are used
+     */
+    public int registerScrollArea(ScrollArea scrollArea) {
+        state();
+        return nativeRegisterScrollArea(nativeHandle, scrollArea.getNativeHandle());
+    }
+
+    /**
+     * Refresh the state page now (it is otherwise updated on resize,
+     * pointer motion, key events, focus changes and setScroll).
+     */
+    public void syncState() {
+        nativeSyncState(nativeHandle);
+    }
+
+    public boolean isFocused(Element element) {
+        return nativeIsFocused(nativeHandle, element.getNativeHandle());
+    }
+
     // Native methods
     private native long nativeGetRootElement(long handle);
     private native void nativeOpen(long handle);
@@ -155,6 +305,19 @@ public class Window {
     private native int[] nativeGetSize(long handle);
     private native void nativeSetResizeCallback(long handle, ResizeListener listener);
     private native void nativeSetKeyboardCallback(long handle, KeyboardListener listener);
+    private native void nativeSetKeyListener(long handle, KeyListener listener);
+    private static native String nativeKeyText();
+    private native void nativeAddFocusable(long handle, long elementHandle);
+    private native void nativeRemoveFocusable(long handle, long elementHandle);
+    private native void nativeFocus(long handle, long elementHandle);
+    private native void nativeMoveFocus(long handle, int direction);
+    private native boolean nativeIsFocused(long handle, long elementHandle);
+    private native int nativeBindKeys(long handle, int[] keysyms, int[] modifiers, boolean onRelease, Runnable action);
+    private native void nativeUnbindKeys(long handle, int id);
+    private native void nativeSetCatchAll(long handle, boolean enabled);
+    private native boolean nativeStatePage(long handle, ByteBuffer page);
+    private native int nativeRegisterScrollArea(long handle, long scrollHandle);
+    private native void nativeSyncState(long handle);
 
     static {
         System.loadLibrary("hyprclj");
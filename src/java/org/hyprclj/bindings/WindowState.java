@@ -0,0 +1,137 @@
+package org.hyprclj.bindings;
+
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.VarHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+/**
+ * Window state shared with native code through a direct buffer.
+ * Native code updates it as events arrive; reads are plain memory loads
+ * with no JNI call and no allocation, so polling is cheap.
+ *
+ * Single-field getters return the latest value. Methods that fill an
+ * array return a consistent snapshot (seqlock: retried while native code
+ * is writing).
+ */
+public final class WindowState {
+    // Keep in sync with SStatePage in hyprclj_state.cpp
+    private static final int SEQ = 0;
+    private static final int WIDTH = 4;
+    private static final int HEIGHT = 8;
+    private static final int SCALE = 12;
+    private static final int POINTER_X = 16;
+    private static final int POINTER_Y = 24;
+    private static final int MODIFIERS = 32;
+    private static final int SCROLL_COUNT = 36;
+    private static final int FOCUSED = 40;
+    private static final int SCROLL = 48;
+    static final int PAGE_SIZE = 320;
+
+    /** Maximum number of registered scroll areas per window. */
+    public static final int SCROLL_SLOTS = 32;
+
+    private static final VarHandle INT =
+        MethodHandles.byteBufferViewVarHandle(int[].class, ByteOrder.nativeOrder());
+
+    private final ByteBuffer page;
+
+    WindowState(ByteBuffer page) {
+        this.page = page.order(ByteOrder.nativeOrder());
+    }
+
+    private int beginRead() {
+        int seq;
+        while (((seq = (int) INT.getAcquire(page, SEQ)) & 1) != 0) {
+            Thread.onSpinWait();
+        }
+        return seq;
+    }
+
+    private boolean endRead(int seq) {
+        VarHandle.loadLoadFence();
+        return (int) INT.get(page, SEQ) == seq;
+    }
+
+    public int width() {
+        return page.getInt(WIDTH);
+    }
+
+    public int height() {
+        return page.getInt(HEIGHT);
+    }
+
+    public float scale() {
+        return page.getFloat(SCALE);
+    }
+
+    /**
+     * Latest xkb modifier mask (Shift=1, Ctrl=4, Alt=8, Super=64).
+     */
+    public int modifiers() {
+        return page.getInt(MODIFIERS);
+    }
+
+    /**
+     * Native handle of the focused element (compare with
+     * Element.getNativeHandle()), or 0 when nothing is focused.
+     */
+    public long focusedHandle() {
+        return page.getLong(FOCUSED);
+    }
+
+    /**
+     * Fill out with [width, height].
+     */
+    public void size(int[] out) {
+        int seq;
+        do {
+            seq = beginRead();
+            out[0] = page.getInt(WIDTH);
+            out[1] = page.getInt(HEIGHT);
+        } while (!endRead(seq));
+    }
+
+    /**
+     * Fill out with the pointer position [x, y] over the root element.
+     */
+    public void pointer(double[] out) {
+        int seq;
+        do {
+            seq = beginRead();
+            out[0] = page.getDouble(POINTER_X);
+            out[1] = page.getDouble(POINTER_Y);
+        } while (!endRead(seq));
+    }
+
+    /**
+     * Fill out with the [x, y] offsets of a scroll area registered with
+     * Window.registerScrollArea.
+     */
+    public void scroll(int slot, int[] out) {
+        if (slot < 0 || slot >= SCROLL_SLOTS) {
+            throw new IndexOutOfBoundsException("scroll slot " + slot);
+        }
+        int seq;
+        do {
+            seq = beginRead();
+            out[0] = page.getInt(SCROLL + slot * 8);
+            out[1] = page.getInt(SCROLL + slot * 8 + 4);
+        } while (!endRead(seq));
+    }
+
+    public int scrollX(int slot) {
+        return page.getInt(SCROLL + slot * 8);
+    }
+
+    public int scrollY(int slot) {
+        return page.getInt(SCROLL + slot * 8 + 4);
+    }
+
+    /**
+     * Number of scroll slots in use.
+     */
+    public int scrollCount() {
+        return page.getInt(SCROLL_COUNT);
+    }
+}